@@ -0,0 +1,140 @@
+/*
+ * benchmark.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <string.h>
+#include "avr_compiler.h"
+#include "TC_driver.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "dfloat.h"
+#include "multiword.h"
+#include "piSpigot.h"
+#include "benchmark.h"
+
+// Operations per timed block, small enough that a block of the slowest
+// operation (double-float divide, C spigot pass) stays below the 16-bit
+// counter range
+#define BENCHMARK_OPS		4
+#define BENCHMARK_ROUNDS	16
+
+// Words resp. remainder terms per multi-word operation
+#define BENCHMARK_WORDS		8
+
+typedef void (*benchmarkOp_t)(void);
+
+// volatile operands, so the compiler can neither fold nor hoist the operations
+static volatile float floatA = 3.14159265f, floatB = 1.00001f, floatResult;
+static volatile dfloat_t dfloatA = { DFLOAT_PI_HI, DFLOAT_PI_LO };
+static volatile dfloat_t dfloatB = { 1.00001f, 1.0e-9f };
+static volatile dfloat_t dfloatResult;
+
+static void opNone(void)      { floatResult = floatA; }
+static void opFloatAdd(void)  { floatResult = floatA + floatB; }
+static void opFloatMul(void)  { floatResult = floatA * floatB; }
+static void opFloatDiv(void)  { floatResult = floatA / floatB; }
+static void opDfloatAdd(void) { dfloatResult = dfAdd(dfloatA, dfloatB); }
+static void opDfloatMul(void) { dfloatResult = dfMul(dfloatA, dfloatB); }
+static void opDfloatDiv(void) { dfloatResult = dfDiv(dfloatA, dfloatB); }
+
+// Multi-word operands: the leading words of pi in hex, a spigot array in its
+// initial state, divisor 239^2 and factor 10000 as in the Machin engine and
+// mwFormat, the largest prime modulus below 2^16
+static const mword_t mwSource[BENCHMARK_WORDS] = { 0x0003, 0x243F, 0x6A88, 0x85A3, 0x08D3, 0x1319, 0x8A2E, 0x0370 };
+static mword_t mwResult[BENCHMARK_WORDS];
+static uint16_t spigotTerms[BENCHMARK_WORDS];
+static volatile uint16_t mulModA = 40000, mulModB = 54321;
+static volatile uint16_t mwSink;
+
+static void opDivSmallRef(void) { mwSink = mwDivSmallRef(mwResult, mwSource, BENCHMARK_WORDS, 57121); }
+static void opDivSmall(void)    { mwSink = mwDivSmall(mwResult, mwSource, BENCHMARK_WORDS, 57121); }
+static void opMulSmallRef(void) { mwSink = mwMulSmallRef(mwResult, BENCHMARK_WORDS, 10000); }
+static void opMulSmall(void)    { mwSink = mwMulSmall(mwResult, BENCHMARK_WORDS, 10000); }
+static void opMulModRef(void)   { mwSink = mwMulModRef(mulModA, mulModB, 65521); }
+static void opMulMod(void)      { mwSink = mwMulMod(mulModA, mulModB, 65521); }
+static void opSpigotRef(void)   { mwSink = spigotPassRef(spigotTerms, BENCHMARK_WORDS); }
+static void opSpigot(void)      { mwSink = spigotPass(spigotTerms, BENCHMARK_WORDS); }
+
+static void benchmarkTimerStart(void)
+{
+	TC_SetPeriod(&TCC1, 0xFFFF);
+	TC1_ConfigWGM(&TCC1, TC_WGMODE_NORMAL_gc);
+	TC1_ConfigClockSource(&TCC1, TC_CLKSEL_DIV1_gc);
+}
+
+static void benchmarkTimerStop(void)
+{
+	TC1_ConfigClockSource(&TCC1, TC_CLKSEL_OFF_gc);
+}
+
+static uint32_t measureCycles(benchmarkOp_t op)
+{
+	uint32_t cycles = 0;
+
+	for (uint8_t round = 0; round < BENCHMARK_ROUNDS; round++) {
+		taskENTER_CRITICAL();
+		TC_SetCount(&TCC1, 0);
+		for (uint8_t i = 0; i < BENCHMARK_OPS; i++) {
+			op();
+		}
+		uint16_t count = TCC1.CNT;
+		taskEXIT_CRITICAL();
+		cycles += count;
+	}
+	return cycles;
+}
+
+static uint16_t cyclesPerOp(benchmarkOp_t op, uint32_t overhead)
+{
+	uint32_t cycles = measureCycles(op);
+	cycles = (cycles > overhead) ? cycles - overhead : 0;
+	return (uint16_t)(cycles / (BENCHMARK_OPS * BENCHMARK_ROUNDS));
+}
+
+// The multiply and the spigot pass work in place, so every run starts from
+// the same operands: the reference and the kernel then time identical work
+static uint16_t multiwordCyclesPerOp(benchmarkOp_t op, uint32_t overhead)
+{
+	memcpy(mwResult, mwSource, sizeof(mwResult));
+	for (uint8_t i = 0; i < BENCHMARK_WORDS; i++) {
+		spigotTerms[i] = 2;
+	}
+	return cyclesPerOp(op, overhead);
+}
+
+void vBenchmarkDoubleFloat(dfloatBenchmark_t *result)
+{
+	benchmarkTimerStart();
+
+	// Call and operand load overhead is measured once and subtracted
+	uint32_t overhead = measureCycles(opNone);
+
+	result->floatAdd = cyclesPerOp(opFloatAdd, overhead);
+	result->floatMul = cyclesPerOp(opFloatMul, overhead);
+	result->floatDiv = cyclesPerOp(opFloatDiv, overhead);
+	result->dfloatAdd = cyclesPerOp(opDfloatAdd, overhead);
+	result->dfloatMul = cyclesPerOp(opDfloatMul, overhead);
+	result->dfloatDiv = cyclesPerOp(opDfloatDiv, overhead);
+
+	benchmarkTimerStop();
+}
+
+void vBenchmarkMultiword(multiwordBenchmark_t *result)
+{
+	benchmarkTimerStart();
+
+	uint32_t overhead = measureCycles(opNone);
+
+	result->divSmallRef = multiwordCyclesPerOp(opDivSmallRef, overhead) / BENCHMARK_WORDS;
+	result->divSmall = multiwordCyclesPerOp(opDivSmall, overhead) / BENCHMARK_WORDS;
+	result->mulSmallRef = multiwordCyclesPerOp(opMulSmallRef, overhead) / BENCHMARK_WORDS;
+	result->mulSmall = multiwordCyclesPerOp(opMulSmall, overhead) / BENCHMARK_WORDS;
+	result->mulModRef = multiwordCyclesPerOp(opMulModRef, overhead);
+	result->mulMod = multiwordCyclesPerOp(opMulMod, overhead);
+	result->spigotRef = multiwordCyclesPerOp(opSpigotRef, overhead) / BENCHMARK_WORDS;
+	result->spigot = multiwordCyclesPerOp(opSpigot, overhead) / BENCHMARK_WORDS;
+
+	benchmarkTimerStop();
+}
@@ -0,0 +1,121 @@
+/*
+ * checkpoint.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "checkpoint.h"
+
+// CRC-16-CCITT (polynomial 0x1021), bitwise, a record is checked at boot
+// and written once a minute
+static uint16_t crcUpdate(uint16_t crc, const uint8_t *data, uint16_t length)
+{
+	while (length-- > 0) {
+		crc ^= (uint16_t)*data++ << 8;
+		for (uint8_t bit = 0; bit < 8; bit++) {
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+static uint16_t slotAddress(const checkpointRing_t *ring, uint8_t slot)
+{
+	return ring->base + (uint16_t)slot * ring->slotSize;
+}
+
+bool checkpointRecordValid(const nvStore_t *store, uint16_t address, uint8_t slotSize, checkpointHeader_t *header)
+{
+	uint8_t bytes[CHECKPOINT_HEADER_BYTES];
+
+	store->read(address, bytes, CHECKPOINT_HEADER_BYTES);
+	if (bytes[0] != CHECKPOINT_MAGIC || bytes[2] > slotSize - CHECKPOINT_OVERHEAD) {
+		return false;
+	}
+	header->id = bytes[1];
+	header->length = bytes[2];
+	header->sequence = (uint32_t)bytes[3] | ((uint32_t)bytes[4] << 8) | ((uint32_t)bytes[5] << 16) | ((uint32_t)bytes[6] << 24);
+
+	// CRC over header and payload, read in small pieces
+	uint16_t crc = crcUpdate(0xFFFF, bytes, CHECKPOINT_HEADER_BYTES);
+	uint16_t offset = CHECKPOINT_HEADER_BYTES;
+	uint16_t end = CHECKPOINT_HEADER_BYTES + header->length;
+	uint8_t chunk[16];
+	while (offset < end) {
+		uint16_t length = end - offset;
+		if (length > sizeof(chunk)) {
+			length = sizeof(chunk);
+		}
+		store->read(address + offset, chunk, length);
+		crc = crcUpdate(crc, chunk, length);
+		offset += length;
+	}
+	store->read(address + end, chunk, 2);
+	return crc == ((uint16_t)chunk[0] | ((uint16_t)chunk[1] << 8));
+}
+
+void checkpointRingInit(checkpointRing_t *ring, const nvStore_t *store, uint16_t base, uint8_t slots, uint8_t slotSize, uint8_t id)
+{
+	ring->store = store;
+	ring->base = base;
+	ring->slots = slots;
+	ring->slotSize = slotSize;
+	ring->id = id;
+	ring->newest = slots;
+	ring->sequence = 0;
+
+	for (uint8_t slot = 0; slot < slots; slot++) {
+		checkpointHeader_t header;
+		if (checkpointRecordValid(store, slotAddress(ring, slot), slotSize, &header) && header.id == id &&
+			(ring->newest == slots || header.sequence > ring->sequence)) {
+			ring->newest = slot;
+			ring->sequence = header.sequence;
+		}
+	}
+}
+
+bool checkpointLoad(const checkpointRing_t *ring, void *head, uint8_t headLength, void *body, uint8_t bodyLength)
+{
+	checkpointHeader_t header;
+
+	if (ring->newest >= ring->slots) {
+		return false;
+	}
+	uint16_t address = slotAddress(ring, ring->newest);
+	// Checked again, the scan may be long ago
+	if (!checkpointRecordValid(ring->store, address, ring->slotSize, &header) || header.length != headLength + bodyLength) {
+		return false;
+	}
+	ring->store->read(address + CHECKPOINT_HEADER_BYTES, head, headLength);
+	ring->store->read(address + CHECKPOINT_HEADER_BYTES + headLength, body, bodyLength);
+	return true;
+}
+
+bool checkpointSave(checkpointRing_t *ring, const void *head, uint8_t headLength, const void *body, uint8_t bodyLength)
+{
+	uint16_t length = (uint16_t)headLength + bodyLength;
+
+	if (ring->slots == 0 || length > ring->slotSize - CHECKPOINT_OVERHEAD) {
+		return false;
+	}
+	uint8_t slot = (ring->newest + 1 < ring->slots) ? ring->newest + 1 : 0;
+	uint32_t sequence = ring->sequence + 1;
+	uint8_t header[CHECKPOINT_HEADER_BYTES] = {
+		CHECKPOINT_MAGIC, ring->id, (uint8_t)length,
+		(uint8_t)sequence, (uint8_t)(sequence >> 8), (uint8_t)(sequence >> 16), (uint8_t)(sequence >> 24)
+	};
+	uint16_t crc = crcUpdate(0xFFFF, header, CHECKPOINT_HEADER_BYTES);
+	crc = crcUpdate(crc, head, headLength);
+	crc = crcUpdate(crc, body, bodyLength);
+	uint8_t crcBytes[2] = { (uint8_t)crc, (uint8_t)(crc >> 8) };
+
+	// The newest record stays intact until this one is complete
+	uint16_t address = slotAddress(ring, slot);
+	ring->store->write(address, header, CHECKPOINT_HEADER_BYTES);
+	ring->store->write(address + CHECKPOINT_HEADER_BYTES, head, headLength);
+	ring->store->write(address + CHECKPOINT_HEADER_BYTES + headLength, body, bodyLength);
+	ring->store->write(address + CHECKPOINT_HEADER_BYTES + length, crcBytes, 2);
+	ring->newest = slot;
+	ring->sequence = sequence;
+	return true;
+}
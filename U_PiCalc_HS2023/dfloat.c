@@ -0,0 +1,184 @@
+/*
+ * dfloat.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <math.h>
+#include "dfloat.h"
+
+// 2^12 + 1, splits a 24-bit float mantissa into two 12-bit halves
+#define DFLOAT_SPLITTER 4097.0f
+
+static dfloat_t quickTwoSum(float a, float b)
+{
+	// Requires |a| >= |b|
+	dfloat_t r;
+	r.hi = a + b;
+	r.lo = b - (r.hi - a);
+	return r;
+}
+
+static dfloat_t twoSum(float a, float b)
+{
+	dfloat_t r;
+	r.hi = a + b;
+	float bb = r.hi - a;
+	r.lo = (a - (r.hi - bb)) + (b - bb);
+	return r;
+}
+
+static void split(float a, float *hi, float *lo)
+{
+	float t = DFLOAT_SPLITTER * a;
+	*hi = t - (t - a);
+	*lo = a - *hi;
+}
+
+static dfloat_t twoProd(float a, float b)
+{
+	// No fused multiply-add on the AVR, so Dekker's product is used
+	float ah, al, bh, bl;
+	dfloat_t r;
+	r.hi = a * b;
+	split(a, &ah, &al);
+	split(b, &bh, &bl);
+	r.lo = ((ah * bh - r.hi) + ah * bl + al * bh) + al * bl;
+	return r;
+}
+
+dfloat_t dfFromFloat(float value)
+{
+	dfloat_t r = { value, 0.0f };
+	return r;
+}
+
+dfloat_t dfFromUint32(uint32_t value)
+{
+	// Exact: the low byte is representable separately
+	float high = (float)(value & 0xFFFFFF00UL);
+	float low = (float)(uint8_t)(value & 0xFF);
+	return quickTwoSum(high, low);
+}
+
+float dfToFloat(dfloat_t value)
+{
+	return value.hi + value.lo;
+}
+
+dfloat_t dfAdd(dfloat_t a, dfloat_t b)
+{
+	dfloat_t s = twoSum(a.hi, b.hi);
+	dfloat_t t = twoSum(a.lo, b.lo);
+	s.lo += t.hi;
+	s = quickTwoSum(s.hi, s.lo);
+	s.lo += t.lo;
+	return quickTwoSum(s.hi, s.lo);
+}
+
+dfloat_t dfNeg(dfloat_t a)
+{
+	a.hi = -a.hi;
+	a.lo = -a.lo;
+	return a;
+}
+
+dfloat_t dfSub(dfloat_t a, dfloat_t b)
+{
+	return dfAdd(a, dfNeg(b));
+}
+
+dfloat_t dfAbs(dfloat_t a)
+{
+	return (a.hi < 0.0f) ? dfNeg(a) : a;
+}
+
+dfloat_t dfMul(dfloat_t a, dfloat_t b)
+{
+	dfloat_t p = twoProd(a.hi, b.hi);
+	p.lo += a.hi * b.lo + a.lo * b.hi;
+	return quickTwoSum(p.hi, p.lo);
+}
+
+dfloat_t dfMulFloat(dfloat_t a, float b)
+{
+	dfloat_t p = twoProd(a.hi, b);
+	p.lo += a.lo * b;
+	return quickTwoSum(p.hi, p.lo);
+}
+
+dfloat_t dfDiv(dfloat_t a, dfloat_t b)
+{
+	// Long division: three float quotient digits, each one correcting the remainder
+	float q1 = a.hi / b.hi;
+	dfloat_t r = dfSub(a, dfMulFloat(b, q1));
+	float q2 = r.hi / b.hi;
+	r = dfSub(r, dfMulFloat(b, q2));
+	float q3 = r.hi / b.hi;
+	return dfAdd(quickTwoSum(q1, q2), dfFromFloat(q3));
+}
+
+int8_t dfCompare(dfloat_t a, dfloat_t b)
+{
+	if (a.hi < b.hi) {
+		return -1;
+	}
+	if (a.hi > b.hi) {
+		return 1;
+	}
+	if (a.lo < b.lo) {
+		return -1;
+	}
+	if (a.lo > b.lo) {
+		return 1;
+	}
+	return 0;
+}
+
+void dfToDecimalString(char *buffer, dfloat_t value, uint8_t decimals)
+{
+	uint32_t scale = 1;
+
+	if (decimals > 9) {
+		decimals = 9;
+	}
+	if (value.hi < 0.0f) {
+		*buffer++ = '-';
+		value = dfNeg(value);
+	}
+	for (uint8_t i = 0; i < decimals; i++) {
+		scale *= 10;
+	}
+
+	// Powers of ten up to 1e10 are exact floats, so scaling adds no error
+	value = dfAdd(dfMulFloat(value, (float)scale), dfFromFloat(0.5f));
+
+	// Floor of the double-float, both parts are integral afterwards
+	float hi = floorf(value.hi);
+	float lo = (hi == value.hi) ? floorf(value.lo) : 0.0f;
+	uint32_t fixedValue = (uint32_t)hi + (int32_t)lo;
+
+	uint32_t whole = fixedValue / scale;
+	uint32_t fraction = fixedValue % scale;
+
+	// Integer part, written backwards
+	char digits[10];
+	uint8_t count = 0;
+	do {
+		digits[count++] = '0' + (whole % 10);
+		whole /= 10;
+	} while (whole > 0);
+	while (count > 0) {
+		*buffer++ = digits[--count];
+	}
+
+	if (decimals > 0) {
+		*buffer++ = '.';
+		for (uint8_t i = decimals; i > 0; i--) {
+			buffer[i - 1] = '0' + (fraction % 10);
+			fraction /= 10;
+		}
+		buffer += decimals;
+	}
+	*buffer = '\0';
+}
@@ -0,0 +1,126 @@
+/*
+ * engineAgm.c
+ *
+ * Created: 16.10.2026
+ *
+ * Computes pi with the Gauss-Legendre (AGM) iteration and shows the leading
+ * digits with the iteration and digit progress. The digits the iteration
+ * declares correct are checked against the reference table before they count.
+ */
+
+#include <avr/pgmspace.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "errorHandler.h"
+#include "piCalcConfig.h"
+#include "piEngine.h"
+#include "piAgm.h"
+#include "piReference.h"
+
+#define AGM_DISPLAY_DECIMALS 18
+
+// 1e-1 in units of 2^-32, the resolution of agmErrorQ32()
+#define AGM_TENTH_Q32 429496730UL
+
+typedef struct {
+	agmState_t agm;
+	mword_t *buffer;
+	// Leading digits, iteration and digit progress
+	char digitString[AGM_DISPLAY_DECIMALS + 3];
+	volatile uint8_t iterations;
+	volatile uint16_t digitsDone;
+	uint16_t digitsMax;
+	piVerify_t verify;
+} agmEngine_t;
+
+static agmEngine_t agm;
+
+static void agmEngineSetup(void *state)
+{
+	agmEngine_t *engine = state;
+
+	// Allocated before the scheduler starts, the spigot takes the rest of the heap later
+	engine->buffer = pvPortMalloc(AGM_BUFFER_WORDS(PI_AGM_WORDS) * sizeof(mword_t));
+	if (engine->buffer == NULL) {
+		error(ERR_LOW_HEAP_SPACE);
+	}
+	agmInit(&engine->agm, engine->buffer, PI_AGM_WORDS);
+	engine->digitsMax = agmDigitsTotal(&engine->agm);
+	strcpy_P(engine->digitString, PSTR("3."));
+}
+
+static void agmEngineInit(void *state)
+{
+	agmEngine_t *engine = state;
+
+	agmInit(&engine->agm, engine->buffer, PI_AGM_WORDS);
+	engine->iterations = 0;
+	engine->digitsDone = 0;
+	piVerifyInit(&engine->verify);
+}
+
+// One iteration per step, a few ms even for long numbers
+static uint16_t agmEngineStep(void *state)
+{
+	agmEngine_t *engine = state;
+
+	bool more = agmStep(&engine->agm);
+
+	// The scratch numbers are free after a step, they serve for the check
+	uint16_t decimals = piVerifyMultiword(&engine->verify, engine->agm.pi, engine->agm.words,
+		agmDigits(&engine->agm), engine->agm.scratch);
+	if (!more) {
+		return decimals | PI_STEP_FINISHED;
+	}
+
+	// The digit count is conservative, the error bound in 2^-32 units is
+	// sharper for the first decimals
+	uint32_t error = agmErrorQ32(&engine->agm);
+	uint32_t threshold = AGM_TENTH_Q32;
+	uint16_t errorDecimals = 0;
+	while (error < threshold && threshold > 0) {
+		threshold /= 10;
+		errorDecimals++;
+	}
+	return (errorDecimals > decimals) ? errorDecimals : decimals;
+}
+
+static void agmEngineBatch(void *state)
+{
+	agmEngine_t *engine = state;
+	char digitString[AGM_DISPLAY_DECIMALS + 3];
+
+	// Publish the leading digits, the scratch numbers are free between two steps
+	agmFormat(&engine->agm, digitString, AGM_DISPLAY_DECIMALS);
+	taskENTER_CRITICAL();
+	strcpy(engine->digitString, digitString);
+	taskEXIT_CRITICAL();
+	engine->iterations = engine->agm.iterations;
+	engine->digitsDone = engine->verify.verified;
+}
+
+static void agmEngineResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	agmEngine_t *engine = state;
+
+	strcpy_P(lines[0], PSTR("Gauss-Legendre AGM"));
+	taskENTER_CRITICAL();
+	strcpy(lines[1], engine->digitString);
+	TickType_t elapsedTime = status->elapsedTime;
+	taskEXIT_CRITICAL();
+	snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR("%lums it%u %u/%udg"), elapsedTime, engine->iterations, engine->digitsDone, engine->digitsMax);
+}
+
+const piEngine_t piEngineAgm = {
+	.name = "AGM",
+	.state = &agm,
+	.estimatesPi = true,
+	.clockToAccuracy = true,
+	.setup = agmEngineSetup,
+	.init = agmEngineInit,
+	.step = agmEngineStep,
+	.batch = agmEngineBatch,
+	.result = agmEngineResult,
+};
@@ -0,0 +1,134 @@
+/*
+ * engineBbp.c
+ *
+ * Created: 16.10.2026
+ *
+ * Extracts hex digit n of pi with the BBP formula. The position is picked
+ * with long presses: button 1 adds the step, button 2 cycles the step
+ * through 1, 10, 100 and 1000. A step past BBP_MAX_POSITION stops at it and
+ * the display says so, the next one starts over at 1. The worker applies them, the controller only
+ * reads the position for the display.
+ */
+
+#include <avr/pgmspace.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ButtonHandler.h"
+#include "piEngine.h"
+#include "piBbp.h"
+
+typedef struct {
+	bbpState_t bbp;
+	// Position picked with long presses, result digit
+	volatile uint32_t position;
+	volatile uint32_t positionStep;
+	volatile uint32_t progress;		// terms done of the current position
+	volatile uint32_t resultPosition;
+	volatile uint8_t resultDigit;
+	volatile bool complete;
+	volatile bool capped;			// the last step hit BBP_MAX_POSITION
+} bbpEngine_t;
+
+static bbpEngine_t bbp = { .position = 1, .positionStep = 1 };
+
+static void bbpEngineInit(void *state)
+{
+	bbpEngine_t *engine = state;
+
+	bbpInit(&engine->bbp, engine->position);
+	engine->progress = 0;
+	engine->complete = false;
+}
+
+// A new position, or Start after a finished run, starts over
+static bool bbpEngineStart(void *state)
+{
+	bbpEngine_t *engine = state;
+
+	if (engine->complete || engine->bbp.position != engine->position) {
+		bbpEngineInit(engine);
+		return true;
+	}
+	return false;
+}
+
+// A single hex digit is no estimate of pi, the decimals stay 0
+static uint16_t bbpEngineStep(void *state)
+{
+	bbpEngine_t *engine = state;
+
+	if (!bbpStep(&engine->bbp)) {
+		engine->resultDigit = bbpDigit(&engine->bbp);
+		engine->resultPosition = engine->bbp.position;
+		engine->complete = true;
+		return PI_STEP_FINISHED;
+	}
+	return 0;
+}
+
+static void bbpEngineBatch(void *state)
+{
+	bbpEngine_t *engine = state;
+
+	engine->progress = engine->bbp.k;
+}
+
+static void bbpEngineResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	bbpEngine_t *engine = state;
+
+	// The worker writes the 32-bit values, read them in one piece
+	taskENTER_CRITICAL();
+	uint32_t position = engine->position;
+	uint32_t positionStep = engine->positionStep;
+	uint32_t resultPosition = engine->resultPosition;
+	uint32_t progress = engine->progress;
+	bool complete = engine->complete;
+	bool capped = engine->capped;
+	TickType_t elapsedTime = status->elapsedTime;
+	taskEXIT_CRITICAL();
+
+	strcpy_P(lines[0], PSTR("BBP Hex Digit"));
+	if (capped) {
+		snprintf_P(lines[1], PI_ENGINE_LINE_SIZE, PSTR("n=%lu max step %lu"), position, positionStep);
+	} else {
+		snprintf_P(lines[1], PI_ENGINE_LINE_SIZE, PSTR("n=%lu step %lu"), position, positionStep);
+	}
+	if (complete) {
+		snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR("#%lu=%X %lums"), resultPosition, engine->resultDigit, elapsedTime);
+	} else {
+		snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR("k=%lu %lums"), progress, elapsedTime);
+	}
+}
+
+static void bbpEngineLongPress(void *state, uint8_t button)
+{
+	bbpEngine_t *engine = state;
+
+	if (button == BUTTON1) {
+		// Next digit position, held at the largest one the target can do
+		// before it starts over
+		uint32_t position = engine->position + engine->positionStep;
+		if (engine->position == BBP_MAX_POSITION) {
+			position = 1;
+		}
+		engine->capped = (position > BBP_MAX_POSITION);
+		engine->position = engine->capped ? BBP_MAX_POSITION : position;
+	} else if (button == BUTTON2) {
+		// Position step 1, 10, 100, 1000
+		engine->positionStep = (engine->positionStep >= 1000) ? 1 : engine->positionStep * 10;
+	}
+}
+
+const piEngine_t piEngineBbp = {
+	.name = "BBP",
+	.state = &bbp,
+	.init = bbpEngineInit,
+	.start = bbpEngineStart,
+	.step = bbpEngineStep,
+	.batch = bbpEngineBatch,
+	.result = bbpEngineResult,
+	.longPress = bbpEngineLongPress,
+};
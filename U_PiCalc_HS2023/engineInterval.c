@@ -0,0 +1,259 @@
+/*
+ * engineInterval.c
+ *
+ * Created: 16.10.2026
+ *
+ * Encloses pi in an interval [lo, hi] that is guaranteed to contain it,
+ * with the Nilkantha or the Leibniz series. Both alternate with falling
+ * terms, so pi lies between any two consecutive partial sums. Each term is
+ * rounded down resp. up in fixed point (the remainder of the integer
+ * division tells), so the running sums bound the exact partial sum from
+ * both sides. The run finishes when the width certifies PI_INTERVAL_DIGITS
+ * decimals. A long press of button 1 switches the series.
+ */
+
+#include <avr/pgmspace.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ButtonHandler.h"
+#include "piCalcConfig.h"
+#include "piEngine.h"
+
+// Unsigned Q2.61, so 4.0 still fits and the term 4/d is a 2^63 / d division
+typedef uint64_t intervalFixed_t;
+
+#define INTERVAL_FRAC_BITS		61
+#define INTERVAL_ONE			((intervalFixed_t)1 << INTERVAL_FRAC_BITS)
+#define INTERVAL_FOUR			((intervalFixed_t)1 << 63)
+
+// Decimals shown of lo and hi, "[3." plus these and "," fill a display line
+#define INTERVAL_DISPLAY_DECIMALS	16
+
+typedef enum {
+	INTERVAL_NILKANTHA,
+	INTERVAL_LEIBNIZ,
+} intervalSeries_t;
+
+typedef struct {
+	intervalSeries_t series;
+	uint32_t terms;
+	// Partial sum rounded down and up, in the unit of the series (Leibniz sums pi/4)
+	intervalFixed_t sumLo;
+	intervalFixed_t sumHi;
+	// Enclosure of pi, published once per batch for the display
+	intervalFixed_t lo;
+	intervalFixed_t hi;
+	// Certified decimals and the width bound of the next decade
+	intervalFixed_t threshold;
+	uint16_t decimals;
+	// Series picked with a long press, applied by the next Start or Reset;
+	// both run in the worker
+	intervalSeries_t nextSeries;
+	// Display copy, left out of the checkpoint
+	volatile intervalFixed_t shownLo;
+	volatile intervalFixed_t shownHi;
+} intervalEngine_t;
+
+static intervalEngine_t interval;
+
+// Decimals the run of a series proves before it finishes
+static uint16_t intervalTarget(intervalSeries_t series)
+{
+	if (series == INTERVAL_LEIBNIZ && PI_INTERVAL_DIGITS > PI_INTERVAL_LEIBNIZ_DIGITS) {
+		return PI_INTERVAL_LEIBNIZ_DIGITS;
+	}
+	return PI_INTERVAL_DIGITS;
+}
+
+static void intervalInit(void *state)
+{
+	intervalEngine_t *engine = state;
+
+	engine->series = engine->nextSeries;
+	engine->terms = 0;
+	if (engine->series == INTERVAL_LEIBNIZ) {
+		// 0 <= pi <= 4, four times the first two partial sums
+		engine->sumLo = 0;
+		engine->sumHi = 0;
+		engine->lo = 0;
+		engine->hi = INTERVAL_FOUR;
+	} else {
+		// 3 <= pi <= 4
+		engine->sumLo = 3 * INTERVAL_ONE;
+		engine->sumHi = 3 * INTERVAL_ONE;
+		engine->lo = 3 * INTERVAL_ONE;
+		engine->hi = INTERVAL_FOUR;
+	}
+	taskENTER_CRITICAL();
+	engine->shownLo = engine->lo;
+	engine->shownHi = engine->hi;
+	taskEXIT_CRITICAL();
+	engine->threshold = INTERVAL_ONE / 10;
+	engine->decimals = 0;
+}
+
+// A series switch, or Start after a finished run, starts over
+static bool intervalStart(void *state)
+{
+	intervalEngine_t *engine = state;
+
+	if (engine->decimals >= intervalTarget(engine->series) || engine->series != engine->nextSeries) {
+		intervalInit(engine);
+		return true;
+	}
+	return false;
+}
+
+static uint16_t intervalStep(void *state)
+{
+	intervalEngine_t *engine = state;
+	uint32_t k = engine->terms;
+
+	// Term k as the exact quotient 2^63 / d resp. 2^61 / d, rounded down
+	// and up. Leibniz: pi/4 = 1 - 1/3 + ..., Nilkantha: pi = 3 + 4/(2*3*4) - ...
+	intervalFixed_t numerator, divisor;
+	if (engine->series == INTERVAL_LEIBNIZ) {
+		numerator = INTERVAL_ONE;
+		divisor = 2 * (intervalFixed_t)k + 1;
+	} else {
+		intervalFixed_t a = 2 * (intervalFixed_t)k + 2;
+		numerator = INTERVAL_FOUR;
+		divisor = a * (a + 1) * (a + 2);
+	}
+	intervalFixed_t termDown = numerator / divisor;
+	intervalFixed_t termUp = termDown + ((numerator % divisor) != 0);
+
+	// Added terms end above pi and give the upper bound, subtracted ones
+	// end below pi and give the lower bound
+	if ((k & 1) == 0) {
+		engine->sumLo += termDown;
+		engine->sumHi += termUp;
+		engine->hi = (engine->series == INTERVAL_LEIBNIZ) ? 4 * engine->sumHi : engine->sumHi;
+	} else {
+		engine->sumLo -= termUp;
+		engine->sumHi -= termDown;
+		engine->lo = (engine->series == INTERVAL_LEIBNIZ) ? 4 * engine->sumLo : engine->sumLo;
+	}
+	engine->terms = k + 1;
+
+	// Every point of the interval is closer to pi than its width
+	intervalFixed_t width = engine->hi - engine->lo;
+	while (width < engine->threshold && engine->threshold > 0) {
+		engine->threshold /= 10;
+		engine->decimals++;
+	}
+	// The term index must not wrap, term 0 would be added again
+	if (engine->decimals >= intervalTarget(engine->series) || engine->terms == UINT32_MAX) {
+		return engine->decimals | PI_STEP_FINISHED;
+	}
+	return engine->decimals;
+}
+
+static void intervalBatch(void *state)
+{
+	intervalEngine_t *engine = state;
+
+	taskENTER_CRITICAL();
+	engine->shownLo = engine->lo;
+	engine->shownHi = engine->hi;
+	taskEXIT_CRITICAL();
+}
+
+// Writes "3." and the decimals of value, rounded down or up so the printed
+// interval still contains the fixed-point one. frac * 10 / 2^s is computed
+// as frac * 5 / 2^(s-1), so the digits are exact without a wider type.
+static void intervalFormat(char *buffer, intervalFixed_t value, bool roundUp)
+{
+	uint8_t bits = INTERVAL_FRAC_BITS;
+	intervalFixed_t fraction = value & (INTERVAL_ONE - 1);
+	char *digit = buffer;
+
+	*digit++ = '0' + (uint8_t)(value >> INTERVAL_FRAC_BITS);
+	*digit++ = '.';
+	for (uint8_t i = 0; i < INTERVAL_DISPLAY_DECIMALS; i++) {
+		fraction *= 5;
+		bits--;
+		*digit++ = '0' + (uint8_t)(fraction >> bits);
+		fraction &= ((intervalFixed_t)1 << bits) - 1;
+	}
+	*digit = '\0';
+
+	// Round up: add one to the last decimal and carry
+	if (roundUp && fraction != 0) {
+		while (--digit >= buffer) {
+			if (*digit == '.') {
+				continue;
+			}
+			if (*digit != '9') {
+				(*digit)++;
+				break;
+			}
+			*digit = '0';
+		}
+	}
+}
+
+static void intervalResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	intervalEngine_t *engine = state;
+	char number[INTERVAL_DISPLAY_DECIMALS + 3];
+
+	taskENTER_CRITICAL();
+	intervalFixed_t lo = engine->shownLo;
+	intervalFixed_t hi = engine->shownHi;
+	TickType_t elapsedTime = status->elapsedTime;
+	taskEXIT_CRITICAL();
+
+	snprintf_P(lines[0], PI_ENGINE_LINE_SIZE, PSTR("IV %-9s%6lums"), (engine->series == INTERVAL_LEIBNIZ) ? "Leibniz" : "Nilkantha", elapsedTime);
+	intervalFormat(number, lo, false);
+	snprintf_P(lines[1], PI_ENGINE_LINE_SIZE, PSTR("[%s,"), number);
+	intervalFormat(number, hi, true);
+	snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR(" %s]"), number);
+}
+
+// The width after n terms is about the next term: 4/(2n+1) for Leibniz,
+// 1/(2(n+1)^3) for Nilkantha
+static uint32_t intervalStepsFor(void *state, uint16_t decimals)
+{
+	intervalEngine_t *engine = state;
+
+	if (decimals > intervalTarget(engine->series)) {
+		return 0;
+	}
+	if (engine->series == INTERVAL_LEIBNIZ) {
+		uint32_t steps = 2;
+		while (decimals-- > 0) {
+			steps *= 10;
+		}
+		return steps;
+	}
+	float steps = cbrt(pow(10.0, decimals) / 2.0) - 1.0;
+	return (steps > 1.0) ? (uint32_t)ceil(steps) : 1;
+}
+
+static void intervalLongPress(void *state, uint8_t button)
+{
+	intervalEngine_t *engine = state;
+
+	if (button == BUTTON1) {
+		engine->nextSeries = (engine->nextSeries == INTERVAL_NILKANTHA) ? INTERVAL_LEIBNIZ : INTERVAL_NILKANTHA;
+	}
+}
+
+const piEngine_t piEngineInterval = {
+	.name = "Interval",
+	.state = &interval,
+	.estimatesPi = true,
+	.init = intervalInit,
+	.start = intervalStart,
+	.step = intervalStep,
+	.batch = intervalBatch,
+	.result = intervalResult,
+	.longPress = intervalLongPress,
+	.stepsFor = intervalStepsFor,
+	.checkpointSize = offsetof(intervalEngine_t, shownLo),
+};
@@ -0,0 +1,105 @@
+/*
+ * engineMachin.c
+ *
+ * Created: 16.10.2026
+ *
+ * Computes a few hundred digits of pi with Machin's formula and shows the
+ * leading ones with the digit progress. The digits the error bound declares
+ * final are checked against the reference table before they count.
+ */
+
+#include <avr/pgmspace.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "errorHandler.h"
+#include "piCalcConfig.h"
+#include "piEngine.h"
+#include "piMachin.h"
+#include "piReference.h"
+
+#define MACHIN_DISPLAY_DECIMALS 18
+
+typedef struct {
+	machinState_t machin;
+	mword_t *buffer;
+	// Leading digits for the display and digit progress
+	char digitString[MACHIN_DISPLAY_DECIMALS + 3];
+	volatile uint16_t digitsDone;
+	uint16_t digitsMax;
+	piVerify_t verify;
+} machinEngine_t;
+
+static machinEngine_t machin;
+
+static void machinEngineSetup(void *state)
+{
+	machinEngine_t *engine = state;
+
+	// Allocated before the scheduler starts, the spigot takes the rest of the heap later
+	engine->buffer = pvPortMalloc(MACHIN_BUFFER_WORDS(PI_MACHIN_WORDS) * sizeof(mword_t));
+	if (engine->buffer == NULL) {
+		error(ERR_LOW_HEAP_SPACE);
+	}
+	machinInit(&engine->machin, engine->buffer, PI_MACHIN_WORDS);
+	engine->digitsMax = machinDigitsTotal(&engine->machin);
+	strcpy_P(engine->digitString, PSTR("3."));
+}
+
+static void machinEngineInit(void *state)
+{
+	machinEngine_t *engine = state;
+
+	machinInit(&engine->machin, engine->buffer, PI_MACHIN_WORDS);
+	engine->digitsDone = 0;
+	piVerifyInit(&engine->verify);
+}
+
+static uint16_t machinEngineStep(void *state)
+{
+	machinEngine_t *engine = state;
+
+	bool more = machinStep(&engine->machin);
+
+	// The term array is free after a step, it serves as scratch for the check
+	uint16_t decimals = piVerifyMultiword(&engine->verify, engine->machin.sum, engine->machin.words,
+		machinDigits(&engine->machin), engine->machin.term);
+	return more ? decimals : (decimals | PI_STEP_FINISHED);
+}
+
+static void machinEngineBatch(void *state)
+{
+	machinEngine_t *engine = state;
+	char digitString[MACHIN_DISPLAY_DECIMALS + 3];
+
+	// Publish the leading digits, the term array is free between two steps
+	machinFormat(&engine->machin, digitString, MACHIN_DISPLAY_DECIMALS);
+	taskENTER_CRITICAL();
+	strcpy(engine->digitString, digitString);
+	taskEXIT_CRITICAL();
+	engine->digitsDone = engine->verify.verified;
+}
+
+static void machinEngineResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	machinEngine_t *engine = state;
+
+	strcpy_P(lines[0], PSTR("Machin Formula"));
+	taskENTER_CRITICAL();
+	strcpy(lines[1], engine->digitString);
+	TickType_t elapsedTime = status->elapsedTime;
+	taskEXIT_CRITICAL();
+	snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR("%lums %u/%udg"), elapsedTime, engine->digitsDone, engine->digitsMax);
+}
+
+const piEngine_t piEngineMachin = {
+	.name = "Machin",
+	.state = &machin,
+	.estimatesPi = true,
+	.setup = machinEngineSetup,
+	.init = machinEngineInit,
+	.step = machinEngineStep,
+	.batch = machinEngineBatch,
+	.result = machinEngineResult,
+};
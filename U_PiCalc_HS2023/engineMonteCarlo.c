@@ -0,0 +1,166 @@
+/*
+ * engineMonteCarlo.c
+ *
+ * Created: 16.10.2026
+ *
+ * Estimates pi as four times the share of random points of the unit square
+ * that fall into the quarter circle, with integer arithmetic only. The
+ * display shows the estimate with its 95 % confidence interval, and the run
+ * stops as soon as that interval proves PI_MONTECARLO_DIGITS decimals.
+ */
+
+#include <avr/pgmspace.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "piCalcConfig.h"
+#include "piEngine.h"
+
+// 16 z^2 with z = 1.96 for a 95 % interval: the squared half-width of the
+// estimate 4p is 16 z^2 p(1-p) / n
+#define MONTECARLO_Z2_16		61.4656f
+
+// p(1-p) for the hit rate p = pi/4
+#define MONTECARLO_PQ			0.168548f
+
+typedef struct {
+	uint32_t random;		// xorshift32 state, never 0
+	uint32_t samples;
+	uint32_t hits;
+	// Certified decimals and the squared half-width of the next decade
+	float threshold;
+	uint16_t decimals;
+	// Display copy, published once per batch
+	volatile uint32_t shownSamples;
+	volatile uint32_t shownHits;
+} monteCarloEngine_t;
+
+static monteCarloEngine_t monteCarlo = { .random = 2463534242UL };
+
+// The generator keeps running across Reset, so every run draws new points
+static void monteCarloInit(void *state)
+{
+	monteCarloEngine_t *engine = state;
+
+	engine->samples = 0;
+	engine->hits = 0;
+	engine->threshold = 1.0e-2f;
+	engine->decimals = 0;
+	taskENTER_CRITICAL();
+	engine->shownSamples = 0;
+	engine->shownHits = 0;
+	taskEXIT_CRITICAL();
+}
+
+static bool monteCarloStart(void *state)
+{
+	monteCarloEngine_t *engine = state;
+
+	if (engine->decimals >= PI_MONTECARLO_DIGITS) {
+		monteCarloInit(engine);
+		return true;
+	}
+	return false;
+}
+
+// PI_MONTECARLO_BATCH points per step
+static uint16_t monteCarloStep(void *state)
+{
+	monteCarloEngine_t *engine = state;
+	uint32_t x = engine->random;
+	uint16_t hits = 0;
+
+	for (uint16_t i = 0; i < PI_MONTECARLO_BATCH; i++) {
+		// xorshift32 with the full-period triple (8, 9, 23): the first shift
+		// is a plain byte move on the AVR
+		x ^= x << 8;
+		x ^= x >> 9;
+		x ^= x << 23;
+
+		// The two halves are the point, taken at the centre of its grid cell:
+		// (u + 1/2)^2 + (v + 1/2)^2 < 2^32 is u(u+1) + v(v+1) <= 2^32 - 1,
+		// and neither product overflows
+		uint16_t u = (uint16_t)(x >> 16);
+		uint16_t v = (uint16_t)x;
+		uint32_t uu = (uint32_t)u * u + u;
+		uint32_t vv = (uint32_t)v * v + v;
+		if (vv <= ~uu) {
+			hits++;
+		}
+	}
+	engine->random = x;
+	engine->samples += PI_MONTECARLO_BATCH;
+	engine->hits += hits;
+
+	// Decimals proven by the confidence interval, one float division per batch
+	float p = (float)engine->hits / (float)engine->samples;
+	float spread = MONTECARLO_Z2_16 * p * (1.0f - p) / (float)engine->samples;
+	while (spread < engine->threshold && engine->decimals < PI_MONTECARLO_MAX_DIGITS) {
+		engine->threshold *= 1.0e-2f;
+		engine->decimals++;
+	}
+
+	// Early abort once the interval is narrow enough, at the latest before
+	// the generator period (2^32 - 1) and the counters run out
+	if (engine->decimals >= PI_MONTECARLO_DIGITS || engine->samples > UINT32_MAX - PI_MONTECARLO_BATCH) {
+		return engine->decimals | PI_STEP_FINISHED;
+	}
+	return engine->decimals;
+}
+
+static void monteCarloBatch(void *state)
+{
+	monteCarloEngine_t *engine = state;
+
+	taskENTER_CRITICAL();
+	engine->shownSamples = engine->samples;
+	engine->shownHits = engine->hits;
+	taskEXIT_CRITICAL();
+}
+
+static void monteCarloResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	monteCarloEngine_t *engine = state;
+
+	taskENTER_CRITICAL();
+	uint32_t samples = engine->shownSamples;
+	uint32_t hits = engine->shownHits;
+	TickType_t elapsedTime = status->elapsedTime;
+	uint16_t decimals = status->decimals;
+	taskEXIT_CRITICAL();
+
+	snprintf_P(lines[0], PI_ENGINE_LINE_SIZE, PSTR("Monte Carlo%7lums"), elapsedTime);
+	if (samples == 0) {
+		strcpy_P(lines[1], PSTR("Start to sample"));
+	} else {
+		float p = (float)hits / (float)samples;
+		float halfWidth = sqrt(MONTECARLO_Z2_16 * p * (1.0f - p) / (float)samples);
+		snprintf_P(lines[1], PI_ENGINE_LINE_SIZE, PSTR("%.6f +-%.6f"), 4.0f * p, halfWidth);
+	}
+	snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR("n=%lu %u/%udg"), samples, decimals, PI_MONTECARLO_DIGITS);
+}
+
+// Samples until the half-width at p = pi/4 falls below 10^-decimals
+static uint32_t monteCarloStepsFor(void *state, uint16_t decimals)
+{
+	if (decimals > PI_MONTECARLO_MAX_DIGITS) {
+		return 0;
+	}
+	float samples = MONTECARLO_Z2_16 * MONTECARLO_PQ * pow(100.0, decimals);
+	return (uint32_t)ceil(samples / PI_MONTECARLO_BATCH);
+}
+
+const piEngine_t piEngineMonteCarlo = {
+	.name = "Monte",
+	.state = &monteCarlo,
+	.estimatesPi = true,
+	.statistical = true,
+	.init = monteCarloInit,
+	.start = monteCarloStart,
+	.step = monteCarloStep,
+	.batch = monteCarloBatch,
+	.result = monteCarloResult,
+	.stepsFor = monteCarloStepsFor,
+};
@@ -0,0 +1,122 @@
+/*
+ * engineRamanujan.c
+ *
+ * Created: 16.10.2026
+ *
+ * Computes pi with Ramanujan's 1/pi series, about 8 digits per term, and
+ * shows the leading digits with the term and digit progress. The digits the
+ * series declares correct are checked against the reference table before
+ * they count.
+ */
+
+#include <avr/pgmspace.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "errorHandler.h"
+#include "piCalcConfig.h"
+#include "piEngine.h"
+#include "piRamanujan.h"
+#include "piReference.h"
+
+#define RAMANUJAN_DISPLAY_DECIMALS 18
+
+typedef struct {
+	ramanujanState_t ramanujan;
+	mword_t *buffer;
+	// Leading digits, term and digit progress
+	char digitString[RAMANUJAN_DISPLAY_DECIMALS + 3];
+	volatile uint16_t terms;
+	volatile uint16_t digitsDone;
+	uint16_t digitsMax;
+	piVerify_t verify;
+} ramanujanEngine_t;
+
+static ramanujanEngine_t ramanujan;
+
+static void ramanujanEngineSetup(void *state)
+{
+	ramanujanEngine_t *engine = state;
+
+	// Allocated before the scheduler starts, the spigot takes the rest of the heap later
+	engine->buffer = pvPortMalloc(RAMANUJAN_BUFFER_WORDS(PI_RAMANUJAN_WORDS) * sizeof(mword_t));
+	if (engine->buffer == NULL) {
+		error(ERR_LOW_HEAP_SPACE);
+	}
+	ramanujanInit(&engine->ramanujan, engine->buffer, PI_RAMANUJAN_WORDS);
+	engine->digitsMax = ramanujanDigitsTotal(&engine->ramanujan);
+	strcpy_P(engine->digitString, PSTR("3."));
+}
+
+static void ramanujanEngineInit(void *state)
+{
+	ramanujanEngine_t *engine = state;
+
+	ramanujanInit(&engine->ramanujan, engine->buffer, PI_RAMANUJAN_WORDS);
+	engine->terms = 0;
+	engine->digitsDone = 0;
+	piVerifyInit(&engine->verify);
+}
+
+// One term per step, the estimate costs a Newton division on top
+static uint16_t ramanujanEngineStep(void *state)
+{
+	ramanujanEngine_t *engine = state;
+
+	bool more = ramanujanStep(&engine->ramanujan);
+
+	// The scratch numbers are free after a step, they serve for the check
+	uint16_t decimals = piVerifyMultiword(&engine->verify, engine->ramanujan.pi, engine->ramanujan.words,
+		ramanujanDigits(&engine->ramanujan), engine->ramanujan.scratch);
+	return more ? decimals : (decimals | PI_STEP_FINISHED);
+}
+
+static void ramanujanEngineBatch(void *state)
+{
+	ramanujanEngine_t *engine = state;
+	char digitString[RAMANUJAN_DISPLAY_DECIMALS + 3];
+
+	// Publish the leading digits, the scratch numbers are free between two steps
+	ramanujanFormat(&engine->ramanujan, digitString, RAMANUJAN_DISPLAY_DECIMALS);
+	taskENTER_CRITICAL();
+	strcpy(engine->digitString, digitString);
+	taskEXIT_CRITICAL();
+	engine->terms = engine->ramanujan.k;
+	engine->digitsDone = engine->verify.verified;
+}
+
+static void ramanujanEngineResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	ramanujanEngine_t *engine = state;
+
+	strcpy_P(lines[0], PSTR("Ramanujan 1/pi"));
+	taskENTER_CRITICAL();
+	strcpy(lines[1], engine->digitString);
+	TickType_t elapsedTime = status->elapsedTime;
+	taskEXIT_CRITICAL();
+	snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR("%lums k%u %u/%udg"), elapsedTime, engine->terms, engine->digitsDone, engine->digitsMax);
+}
+
+static uint32_t ramanujanEngineStepsFor(void *state, uint16_t decimals)
+{
+	ramanujanEngine_t *engine = state;
+
+	if (decimals > engine->digitsMax) {
+		return 0;
+	}
+	return ramanujanTermsFor(decimals);
+}
+
+const piEngine_t piEngineRamanujan = {
+	.name = "Ramanujan",
+	.state = &ramanujan,
+	.estimatesPi = true,
+	.clockToAccuracy = true,
+	.setup = ramanujanEngineSetup,
+	.init = ramanujanEngineInit,
+	.step = ramanujanEngineStep,
+	.batch = ramanujanEngineBatch,
+	.result = ramanujanEngineResult,
+	.stepsFor = ramanujanEngineStepsFor,
+};
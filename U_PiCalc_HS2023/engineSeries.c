@@ -0,0 +1,516 @@
+/*
+ * engineSeries.c
+ *
+ * Created: 16.10.2026
+ *
+ * Leibniz and Nilkantha engines. Both sum an alternating series in the
+ * number format picked by PI_NUMERIC_MODE and show the partial sum next to
+ * the estimate of the acceleration stage, so they share the published
+ * result and the display page.
+ */
+
+#include <avr/pgmspace.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "piCalcConfig.h"
+#include "piEngine.h"
+#include "piFixed.h"
+#include "neumaierSum.h"
+#include "seriesAccel.h"
+#include "dfloat.h"
+
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+typedef dfloat_t seriesValue_t;
+
+static const dfloat_t piReference = { DFLOAT_PI_HI, DFLOAT_PI_LO };
+static const dfloat_t four = { 4.0f, 0.0f };
+#else
+typedef float seriesValue_t;
+#endif
+
+// Error in the number format of the sum, and the decimals it can resolve
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+typedef fixed32_t seriesError_t;
+#define SERIES_MAX_DECIMALS	8
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+typedef fixed64_t seriesError_t;
+#define SERIES_MAX_DECIMALS	18
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+typedef float seriesError_t;
+#define SERIES_MAX_DECIMALS	14
+#else
+typedef float seriesError_t;
+#define SERIES_MAX_DECIMALS	7
+#endif
+
+// Decimals reached so far and the error bound of the next decade
+typedef struct {
+	seriesError_t threshold;
+	uint16_t decimals;
+} seriesDecimals_t;
+
+// Result of a series engine, published once per batch for the display
+typedef struct {
+	volatile float pi;
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	// Full precision results, written inside a critical section
+	volatile dfloat_t piDf;
+#endif
+#if (PI_ACCELERATION != PI_ACCEL_NONE)
+	volatile float accelerated;
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	volatile dfloat_t acceleratedDf;
+#endif
+	// Terms after which the accelerated estimate met the accuracy target, 0 = not yet
+	volatile uint32_t accelTerms;
+#endif
+} seriesResult_t;
+
+// Series terms for the acceleration stage, in float and in units of pi
+static float leibnizTerm(uint32_t k)
+{
+	float term = 4.0f / (2.0f * k + 1.0f);
+	return (k & 1) ? -term : term;
+}
+
+static float nilkanthaTerm(uint32_t k)
+{
+	float a = 2.0f * k + 2.0f;
+	float term = 4.0f / (a * (a + 1.0f) * (a + 2.0f));
+	return (k & 1) ? -term : term;
+}
+
+// Sets the published result back to the start value of the series
+static void seriesReset(seriesResult_t *result, seriesValue_t start)
+{
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	taskENTER_CRITICAL();
+	result->piDf = start;
+	taskEXIT_CRITICAL();
+	result->pi = dfToFloat(start);
+#else
+	result->pi = start;
+#endif
+#if (PI_ACCELERATION != PI_ACCEL_NONE)
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	taskENTER_CRITICAL();
+	result->acceleratedDf = start;
+	taskEXIT_CRITICAL();
+#endif
+	result->accelerated = result->pi;
+	result->accelTerms = 0;
+#endif
+}
+
+// Publishes the partial sum of the first terms terms and its extrapolation
+static void seriesPublish(seriesResult_t *result, seriesValue_t value, seriesTerm_t term, uint32_t terms)
+{
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	taskENTER_CRITICAL();
+	result->piDf = value;
+	taskEXIT_CRITICAL();
+	result->pi = dfToFloat(value);
+#else
+	result->pi = value;
+#endif
+
+#if (PI_ACCELERATION != PI_ACCEL_NONE)
+	// One extrapolation per batch for the display
+	float correction = PI_ACCELERATE(term, terms);
+	result->accelerated = result->pi + correction;
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	dfloat_t accelerated = dfAdd(value, dfFromFloat(correction));
+	taskENTER_CRITICAL();
+	result->acceleratedDf = accelerated;
+	taskEXIT_CRITICAL();
+#endif
+#else
+	(void)term;
+	(void)terms;
+#endif
+}
+
+#if (PI_ACCELERATION != PI_ACCEL_NONE)
+// Until the accelerated estimate meets the target it is checked after every term
+static void seriesCheckAccelerated(seriesResult_t *result, float piRaw, seriesTerm_t term, uint32_t terms)
+{
+	if (result->accelTerms == 0 && fabs(piRaw + PI_ACCELERATE(term, terms) - M_PI) < PI_ACCURACY_TARGET)
+	{
+		result->accelTerms = terms;
+	}
+}
+#endif
+
+// Starts over at 1e-1, given in the unit of the error
+static void seriesDecimalsInit(seriesDecimals_t *tracker, seriesError_t tenth)
+{
+	tracker->threshold = tenth;
+	tracker->decimals = 0;
+}
+
+// Counts the decades the error has fallen below. One compare per term,
+// the division only happens when a decade is reached.
+static uint16_t seriesDecimals(seriesDecimals_t *tracker, seriesError_t error)
+{
+	while (error < tracker->threshold && tracker->decimals < SERIES_MAX_DECIMALS) {
+		tracker->threshold /= 10;
+		tracker->decimals++;
+	}
+	return tracker->decimals;
+}
+
+static void seriesFormat(const char *name, seriesResult_t *result, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	taskENTER_CRITICAL();
+	TickType_t elapsedTime = status->elapsedTime;
+	uint32_t rate = status->rate;
+	taskEXIT_CRITICAL();
+
+#if (PI_ACCELERATION != PI_ACCEL_NONE)
+	// Time on the title line, raw sum with the rate, accelerated estimate below
+	size_t used;
+
+	snprintf_P(lines[0], PI_ENGINE_LINE_SIZE, PSTR("%s %s %lums"), name, PI_NUMERIC_NAME, elapsedTime);
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	// Format the double-float ourselves, printf would round it to float
+	taskENTER_CRITICAL();
+	dfloat_t piValue = result->piDf;
+	dfloat_t accelValue = result->acceleratedDf;
+	taskEXIT_CRITICAL();
+	strcpy_P(lines[1], PSTR("PI "));
+	dfToDecimalString(lines[1] + 3, piValue, 8);
+	strcpy_P(lines[2], PSTR(PI_ACCEL_NAME " "));
+	dfToDecimalString(lines[2] + 2, accelValue, 8);
+#else
+	snprintf_P(lines[1], PI_ENGINE_LINE_SIZE, PSTR("PI %.8f"), result->pi);
+	snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR(PI_ACCEL_NAME " %.8f"), result->accelerated);
+#endif
+	used = strlen(lines[1]);
+	snprintf_P(lines[1] + used, PI_ENGINE_LINE_SIZE - used, PSTR(" %luk/s"), rate / 1000);
+
+	// Terms the accelerated estimate needed for the accuracy target
+	if (result->accelTerms != 0) {
+		used = strlen(lines[2]);
+		snprintf_P(lines[2] + used, PI_ENGINE_LINE_SIZE - used, PSTR(" @%lu"), result->accelTerms);
+	}
+#else
+	snprintf_P(lines[0], PI_ENGINE_LINE_SIZE, PSTR("%s %s"), name, PI_NUMERIC_NAME);
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	// Format the double-float ourselves, printf would round it to float
+	taskENTER_CRITICAL();
+	dfloat_t piValue = result->piDf;
+	taskEXIT_CRITICAL();
+	strcpy_P(lines[1], PSTR("PI: "));
+	dfToDecimalString(lines[1] + 4, piValue, 8);
+#else
+	snprintf_P(lines[1], PI_ENGINE_LINE_SIZE, PSTR("PI: %.8f"), result->pi);
+#endif
+	snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR("%lums %luit/s"), elapsedTime, rate);
+#endif
+}
+
+/*---------------------------------------------------------------------------------*/
+// Leibniz: pi = 4 * (1 - 1/3 + 1/5 - ...)
+/*---------------------------------------------------------------------------------*/
+typedef struct {
+	seriesResult_t result;
+	seriesDecimals_t decimals;
+	uint32_t iterations;
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+	float sign;
+#if (PI_LEIBNIZ_SUMMATION == PI_SUM_NEUMAIER)
+	neumaierSum_t piSum;
+#else
+	float piSum;
+#endif
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	fixed32_t piQuarterFixed;
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	fixed64_t piQuarterFixed;
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	dfloat_t piDfloat;
+#endif
+} leibnizEngine_t;
+
+static leibnizEngine_t leibniz;
+
+static seriesValue_t leibnizValue(const leibnizEngine_t *engine)
+{
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+#if (PI_LEIBNIZ_SUMMATION == PI_SUM_NEUMAIER)
+	return neumaierValue(&engine->piSum);
+#else
+	return engine->piSum;
+#endif
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	return 4 * fixed32ToFloat(engine->piQuarterFixed);
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	return 4 * fixed64ToFloat(engine->piQuarterFixed);
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	return engine->piDfloat;
+#endif
+}
+
+static void leibnizInit(void *state)
+{
+	leibnizEngine_t *engine = state;
+
+	engine->iterations = 0;
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+	engine->sign = 1.0;
+#if (PI_LEIBNIZ_SUMMATION == PI_SUM_NEUMAIER)
+	neumaierInit(&engine->piSum, 0.0f);
+#else
+	engine->piSum = 0.0f;
+#endif
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	engine->piDfloat = dfFromFloat(0.0f);
+#else
+	engine->piQuarterFixed = 0;
+#endif
+	seriesReset(&engine->result, leibnizValue(engine));
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	seriesDecimalsInit(&engine->decimals, FIXED32_FROM_FLOAT(0.1 / 4));
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	seriesDecimalsInit(&engine->decimals, FIXED64_FROM_FLOAT(0.1 / 4));
+#else
+	seriesDecimalsInit(&engine->decimals, 0.1f);
+#endif
+}
+
+static uint16_t leibnizStep(void *state)
+{
+	leibnizEngine_t *engine = state;
+	uint32_t iterations = engine->iterations;
+
+	// Leibniz formula for pi approximation
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+#if (PI_LEIBNIZ_SUMMATION == PI_SUM_NEUMAIER)
+	neumaierAdd(&engine->piSum, (engine->sign / (2 * iterations + 1)) * 4);
+#else
+	engine->piSum += (engine->sign / (2 * iterations + 1)) * 4;
+#endif
+	uint16_t decimals = seriesDecimals(&engine->decimals, fabs(leibnizValue(engine) - M_PI));
+	engine->sign = -engine->sign;
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	fixed32_t term = fixed32LeibnizTerm(iterations);
+	engine->piQuarterFixed += (iterations & 1) ? -term : term;
+	uint16_t decimals = seriesDecimals(&engine->decimals, labs(engine->piQuarterFixed - FIXED32_PI_QUARTER));
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	fixed64_t term = fixed64LeibnizTerm(iterations);
+	engine->piQuarterFixed += (iterations & 1) ? -term : term;
+	uint16_t decimals = seriesDecimals(&engine->decimals, llabs(engine->piQuarterFixed - FIXED64_PI_QUARTER));
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	dfloat_t term = dfDiv(four, dfFromUint32(2 * iterations + 1));
+	engine->piDfloat = (iterations & 1) ? dfSub(engine->piDfloat, term) : dfAdd(engine->piDfloat, term);
+	uint16_t decimals = seriesDecimals(&engine->decimals, dfToFloat(dfAbs(dfSub(engine->piDfloat, piReference))));
+#endif
+
+#if (PI_ACCELERATION != PI_ACCEL_NONE)
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	seriesCheckAccelerated(&engine->result, dfToFloat(engine->piDfloat), leibnizTerm, iterations + 1);
+#else
+	seriesCheckAccelerated(&engine->result, leibnizValue(engine), leibnizTerm, iterations + 1);
+#endif
+#endif
+
+	engine->iterations = iterations + 1;
+	return decimals;
+}
+
+static void leibnizBatch(void *state)
+{
+	leibnizEngine_t *engine = state;
+
+	seriesPublish(&engine->result, leibnizValue(engine), leibnizTerm, engine->iterations);
+}
+
+// The error after n terms is about half the next term, 4/(4n) = 1/n
+static uint32_t leibnizStepsFor(void *state, uint16_t decimals)
+{
+	// 10^10 steps no longer fit the step counter
+	if (decimals > SERIES_MAX_DECIMALS || decimals > 9) {
+		return 0;
+	}
+	uint32_t steps = 1;
+	while (decimals-- > 0) {
+		steps *= 10;
+	}
+	return steps;
+}
+
+static void leibnizResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	leibnizEngine_t *engine = state;
+
+	seriesFormat("Leibniz", &engine->result, status, lines);
+}
+
+const piEngine_t piEngineLeibniz = {
+	.name = "Leibniz",
+	.state = &leibniz,
+	.estimatesPi = true,
+	.clockToAccuracy = true,
+	.init = leibnizInit,
+	.step = leibnizStep,
+	.batch = leibnizBatch,
+	.result = leibnizResult,
+	.stepsFor = leibnizStepsFor,
+	.checkpointSize = sizeof(leibniz),
+};
+
+/*---------------------------------------------------------------------------------*/
+// Nilkantha: pi = 3 + 4/(2*3*4) - 4/(4*5*6) + ...
+/*---------------------------------------------------------------------------------*/
+typedef struct {
+	seriesResult_t result;
+	seriesDecimals_t decimals;
+	uint32_t iterations;
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+	float sign;
+#if (PI_NILKANTHA_SUMMATION == PI_SUM_NEUMAIER)
+	neumaierSum_t piSum;
+#else
+	float piSum;
+#endif
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	fixed32_t piFixed;
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	fixed64_t piFixed;
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	dfloat_t piDfloat;
+#endif
+} nilkanthaEngine_t;
+
+static nilkanthaEngine_t nilkantha;
+
+static seriesValue_t nilkanthaValue(const nilkanthaEngine_t *engine)
+{
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+#if (PI_NILKANTHA_SUMMATION == PI_SUM_NEUMAIER)
+	return neumaierValue(&engine->piSum);
+#else
+	return engine->piSum;
+#endif
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	return fixed32ToFloat(engine->piFixed);
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	return fixed64ToFloat(engine->piFixed);
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	return engine->piDfloat;
+#endif
+}
+
+static void nilkanthaInit(void *state)
+{
+	nilkanthaEngine_t *engine = state;
+
+	engine->iterations = 0;
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+	engine->sign = 1.0;
+#if (PI_NILKANTHA_SUMMATION == PI_SUM_NEUMAIER)
+	neumaierInit(&engine->piSum, 3.0f);
+#else
+	engine->piSum = 3.0f;
+#endif
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	engine->piFixed = FIXED32_THREE;
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	engine->piFixed = FIXED64_THREE;
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	engine->piDfloat = dfFromFloat(3.0f);
+#endif
+	seriesReset(&engine->result, nilkanthaValue(engine));
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	seriesDecimalsInit(&engine->decimals, FIXED32_FROM_FLOAT(0.1));
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	seriesDecimalsInit(&engine->decimals, FIXED64_FROM_FLOAT(0.1));
+#else
+	seriesDecimalsInit(&engine->decimals, 0.1f);
+#endif
+}
+
+static uint16_t nilkanthaStep(void *state)
+{
+	nilkanthaEngine_t *engine = state;
+	uint32_t iterations = engine->iterations;
+
+	// Nilkantha formula for pi approximation
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+	// Denominator in float, the 32-bit integer product overflows beyond ~800 iterations
+	float a = 2.0f * iterations + 2.0f;
+#if (PI_NILKANTHA_SUMMATION == PI_SUM_NEUMAIER)
+	neumaierAdd(&engine->piSum, engine->sign * (4.0f / (a * (a + 1.0f) * (a + 2.0f))));
+#else
+	engine->piSum += engine->sign * (4.0f / (a * (a + 1.0f) * (a + 2.0f)));
+#endif
+	uint16_t decimals = seriesDecimals(&engine->decimals, fabs(nilkanthaValue(engine) - M_PI));
+	engine->sign = -engine->sign;
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+	fixed32_t term = fixed32NilkanthaTerm(iterations);
+	engine->piFixed += (iterations & 1) ? -term : term;
+	uint16_t decimals = seriesDecimals(&engine->decimals, labs(engine->piFixed - FIXED32_PI));
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+	fixed64_t term = fixed64NilkanthaTerm(iterations);
+	engine->piFixed += (iterations & 1) ? -term : term;
+	uint16_t decimals = seriesDecimals(&engine->decimals, llabs(engine->piFixed - FIXED64_PI));
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	uint32_t a = 2 * iterations + 2;
+	dfloat_t denominator = dfMul(dfMul(dfFromUint32(a), dfFromUint32(a + 1)), dfFromUint32(a + 2));
+	dfloat_t term = dfDiv(four, denominator);
+	engine->piDfloat = (iterations & 1) ? dfSub(engine->piDfloat, term) : dfAdd(engine->piDfloat, term);
+	uint16_t decimals = seriesDecimals(&engine->decimals, dfToFloat(dfAbs(dfSub(engine->piDfloat, piReference))));
+#endif
+
+#if (PI_ACCELERATION != PI_ACCEL_NONE)
+#if (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+	seriesCheckAccelerated(&engine->result, dfToFloat(engine->piDfloat), nilkanthaTerm, iterations + 1);
+#else
+	seriesCheckAccelerated(&engine->result, nilkanthaValue(engine), nilkanthaTerm, iterations + 1);
+#endif
+#endif
+
+	engine->iterations = iterations + 1;
+	return decimals;
+}
+
+static void nilkanthaBatch(void *state)
+{
+	nilkanthaEngine_t *engine = state;
+
+	seriesPublish(&engine->result, nilkanthaValue(engine), nilkanthaTerm, engine->iterations);
+}
+
+// The error after n terms is about half the next term, 1/(4(n+1)^3)
+static uint32_t nilkanthaStepsFor(void *state, uint16_t decimals)
+{
+	if (decimals > SERIES_MAX_DECIMALS) {
+		return 0;
+	}
+	float steps = cbrt(pow(10.0, decimals) / 4.0) - 1.0;
+	return (steps > 1.0) ? (uint32_t)ceil(steps) : 1;
+}
+
+static void nilkanthaResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	nilkanthaEngine_t *engine = state;
+
+	seriesFormat("Nilkantha", &engine->result, status, lines);
+}
+
+const piEngine_t piEngineNilkantha = {
+	.name = "Nilkantha",
+	.state = &nilkantha,
+	.estimatesPi = true,
+	.clockToAccuracy = true,
+	.init = nilkanthaInit,
+	.step = nilkanthaStep,
+	.batch = nilkanthaBatch,
+	.result = nilkanthaResult,
+	.stepsFor = nilkanthaStepsFor,
+	.checkpointSize = sizeof(nilkantha),
+};
@@ -0,0 +1,133 @@
+/*
+ * engineSpigot.c
+ *
+ * Created: 16.10.2026
+ *
+ * Streams decimal digits of pi with the Rabinowitz-Wagon spigot and shows
+ * the last 40 as a scrolling ticker. Every released digit is checked against
+ * the reference table, only verified digits count as decimals.
+ */
+
+#include <avr/pgmspace.h>
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "errorHandler.h"
+#include "piCalcConfig.h"
+#include "piEngine.h"
+#include "piSpigot.h"
+#include "piReference.h"
+
+#define SPIGOT_TICKER_LENGTH 40
+
+typedef struct {
+	spigotState_t spigot;
+	uint16_t *remainders;
+	uint16_t length;
+	// Digit stream: last digits for the ticker, count of released digits
+	char ticker[SPIGOT_TICKER_LENGTH + 1];
+	uint8_t tickerFill;		// characters in the ticker (digits plus the decimal point)
+	volatile uint16_t digitsEmitted;
+	piVerify_t verify;
+} spigotEngine_t;
+
+static spigotEngine_t spigot;
+
+static void spigotTickerAppend(spigotEngine_t *engine, char c)
+{
+	if (engine->tickerFill == SPIGOT_TICKER_LENGTH) {
+		memmove(&engine->ticker[0], &engine->ticker[1], SPIGOT_TICKER_LENGTH - 1);
+		engine->ticker[SPIGOT_TICKER_LENGTH - 1] = c;
+	} else {
+		engine->ticker[engine->tickerFill++] = c;
+	}
+}
+
+// Appends a released spigot digit to the ticker, scrolling it when full.
+// The emit callback has no context, so it works on the engine state directly.
+static void spigotEmitDigit(char digit)
+{
+	uint16_t digits = spigot.digitsEmitted;
+
+	taskENTER_CRITICAL();
+	spigotTickerAppend(&spigot, digit);
+	if (digits == 0) {
+		spigotTickerAppend(&spigot, '.');	// decimal point after the leading 3
+	}
+	spigot.digitsEmitted = digits + 1;
+	taskEXIT_CRITICAL();
+
+	// One compare per digit, decimal index 0 is the digit after the 3
+	if (digits > 0) {
+		piVerifyDigit(&spigot.verify, digits - 1, digit);
+	}
+}
+
+static void spigotEngineInit(void *state)
+{
+	spigotEngine_t *engine = state;
+
+	// First call comes from the worker task: the remainder array takes whatever
+	// heap is left once all tasks and the buffers of the other engines exist
+	if (engine->remainders == NULL) {
+		size_t heapBytes = xPortGetFreeHeapSize();
+		heapBytes = (heapBytes > PI_SPIGOT_HEAP_RESERVE) ? heapBytes - PI_SPIGOT_HEAP_RESERVE : 0;
+		if (heapBytes > PI_SPIGOT_MAX_LENGTH * sizeof(uint16_t)) {
+			heapBytes = PI_SPIGOT_MAX_LENGTH * sizeof(uint16_t);
+		}
+		engine->length = heapBytes / sizeof(uint16_t);
+		engine->remainders = pvPortMalloc(engine->length * sizeof(uint16_t));
+		if (engine->remainders == NULL || engine->length < SPIGOT_LENGTH_FOR_DIGITS(SPIGOT_TICKER_LENGTH)) {
+			error(ERR_LOW_HEAP_SPACE);
+		}
+	}
+
+	spigotInit(&engine->spigot, engine->remainders, engine->length);
+	taskENTER_CRITICAL();
+	memset(engine->ticker, 0, sizeof(engine->ticker));
+	engine->tickerFill = 0;
+	engine->digitsEmitted = 0;
+	taskEXIT_CRITICAL();
+	piVerifyInit(&engine->verify);
+}
+
+static uint16_t spigotEngineStep(void *state)
+{
+	spigotEngine_t *engine = state;
+
+	// One digit costs one pass over the active array
+	bool more = spigotStep(&engine->spigot, spigotEmitDigit);
+
+	// Released digits are final, but only the verified ones count
+	uint16_t decimals = engine->verify.verified;
+	return more ? decimals : (decimals | PI_STEP_FINISHED);
+}
+
+static void spigotEngineResult(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	spigotEngine_t *engine = state;
+
+	// Verified decimals, digits per second with one decimal over the whole run
+	taskENTER_CRITICAL();
+	uint16_t digits = engine->digitsEmitted;
+	TickType_t elapsedTime = status->elapsedTime;
+	uint16_t decimals = status->decimals;
+	memcpy(lines[1], &engine->ticker[0], 20);
+	memcpy(lines[2], &engine->ticker[20], 20);
+	taskEXIT_CRITICAL();
+	uint32_t digitRate = (elapsedTime > 0) ? ((uint32_t)digits * 10000UL) / (elapsedTime * portTICK_PERIOD_MS) : 0;
+
+	snprintf_P(lines[0], PI_ENGINE_LINE_SIZE, PSTR("Spigot%5uv%3lu.%lud/s"), decimals, digitRate / 10, digitRate % 10);
+	lines[1][20] = '\0';
+	lines[2][20] = '\0';
+}
+
+const piEngine_t piEngineSpigot = {
+	.name = "Spigot",
+	.state = &spigot,
+	.estimatesPi = true,
+	.init = spigotEngineInit,
+	.step = spigotEngineStep,
+	.result = spigotEngineResult,
+};
@@ -29,9 +29,10 @@
 #define FREERTOS_CONFIG_H
 
 #include <avr/io.h>
+#include "piCalcConfig.h"
 
 #define configUSE_PREEMPTION		1
-#define configUSE_IDLE_HOOK			0
+#define configUSE_IDLE_HOOK			PI_IDLE_COMPUTE	// the idle compute mode runs the engines in the hook
 #define configUSE_TICK_HOOK			0
 
 #define configCPU_CLOCK_HZ			( ( unsigned portLONG ) 32000000 )
@@ -76,12 +77,56 @@
 //#define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES			( 4 )
 #define configMINIMAL_STACK_SIZE		( ( unsigned short ) 200 )
-#define configTOTAL_HEAP_SIZE			( (size_t ) ( 3000 ) )
+// Stack the engines run on: the worker task's, or the idle task's in the
+// idle compute mode
+#define PI_WORKER_STACK_SIZE			( configMINIMAL_STACK_SIZE + 200 )
+
+// 8192 bytes SRAM minus about 2.65 KB static data (format strings in flash),
+// 350 bytes for the stack of main() until the scheduler starts and 400 bytes
+// margin, as the static data is an estimate and not a linked map. The tasks
+// and engine buffers take about 3.7 KB, the spigot engine the rest; main()
+// checks after setup that the spigot's reserve is left.
+// In the idle compute mode the idle and timer task stacks and TCBs are static
+// (main.c), so the heap shrinks by the same 696 bytes to 4104. Without the
+// worker task and with those two tasks the tasks and buffers take about
+// 2.8 KB of it, which leaves the spigot slightly more than in the default mode.
+#if (PI_IDLE_COMPUTE == 0)
+#define configTOTAL_HEAP_SIZE			( (size_t ) ( 4800 ) )
+#else
+#define configTOTAL_HEAP_SIZE			( (size_t ) ( 4800 - ( PI_WORKER_STACK_SIZE + configTIMER_TASK_STACK_DEPTH ) - 2 * sizeof( StaticTask_t ) ) )
+#endif
 #define configMAX_TASK_NAME_LEN			( 8 )
 #define configUSE_TRACE_FACILITY		1
 #define configUSE_16_BIT_TICKS			0
 #define configIDLE_SHOULD_YIELD			1
 #define configCHECK_FOR_STACK_OVERFLOW	2
+#define configSUPPORT_STATIC_ALLOCATION	PI_IDLE_COMPUTE	// the idle task gets the worker's stack
+
+/* Run-time statistics on TCD0, see runTimeStats.h */
+#define configGENERATE_RUN_TIME_STATS	PI_RUNTIME_STATS
+#if (PI_RUNTIME_STATS == 1)
+#include "runTimeStats.h"
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()	vRunTimeStatsInit()
+#define portGET_RUN_TIME_COUNTER_VALUE()			ulRunTimeStatsCounter()
+#endif
+
+/* Scheduler trace, see traceRecorder.h. The macros expand inside the kernel
+sources, where the TCB, queue and event group types are known. */
+#if (PI_TRACE == 1)
+#include "traceRecorder.h"
+#define traceTASK_CREATE( pxNewTCB )						vTraceTaskCreated( ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName )
+#define traceTASK_SWITCHED_IN()								vTraceRecord( TRACE_SWITCHED_IN, pxCurrentTCB->uxTCBNumber )
+#define traceTASK_SWITCHED_OUT()							vTraceRecord( TRACE_SWITCHED_OUT, pxCurrentTCB->uxTCBNumber )
+#define traceQUEUE_CREATE( pxNewQueue )						( pxNewQueue )->uxQueueNumber = uxTraceQueueNumber()
+#define traceQUEUE_SEND( pxQueue )							vTraceRecord( TRACE_QUEUE_SEND, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE( pxQueue )						vTraceRecord( TRACE_QUEUE_RECEIVE, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )					vTraceRecord( TRACE_QUEUE_SEND_ISR, ( pxQueue )->uxQueueNumber )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )				vTraceRecord( TRACE_QUEUE_RECEIVE_ISR, ( pxQueue )->uxQueueNumber )
+#define traceEVENT_GROUP_CREATE( pxEventBits )				( pxEventBits )->uxEventGroupNumber = uxTraceEventGroupNumber()
+#define traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet )	vTraceRecord( TRACE_EVENT_GROUP_SET, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+#define traceTASK_NOTIFY()									vTraceRecord( TRACE_TASK_NOTIFY, pxTCB->uxTCBNumber )
+#define traceTASK_NOTIFY_FROM_ISR()							vTraceRecord( TRACE_TASK_NOTIFY_ISR, pxTCB->uxTCBNumber )
+#endif
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES 		1
@@ -100,6 +145,7 @@ to exclude the API function. */
 
 #define INCLUDE_uxTaskGetStackHighWaterMark	1 // used to check if stack is going low
 #define	INCLUDE_xTaskGetCurrentTaskHandle	1
+#define INCLUDE_xTaskGetIdleTaskHandle	PI_IDLE_COMPUTE	// the idle compute mode's worker
 
 #define configUSE_TIMERS				1
 #define INCLUDE_xTimerPendFunctionCall	1
@@ -0,0 +1,45 @@
+/*
+ * benchmark.h
+ *
+ * Created: 16.10.2026
+ *
+ * On-target micro benchmarks. Timer/Counter TCC1 runs at the CPU clock while
+ * a benchmark is measured, so all results are in CPU cycles per operation.
+ */
+
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <stdint.h>
+
+typedef struct {
+	uint16_t floatAdd;
+	uint16_t floatMul;
+	uint16_t floatDiv;
+	uint16_t dfloatAdd;
+	uint16_t dfloatMul;
+	uint16_t dfloatDiv;
+} dfloatBenchmark_t;
+
+// Cycles per add / mul / div for float and double-float. Runs with the
+// scheduler interrupts masked for a few milliseconds per operation type.
+void vBenchmarkDoubleFloat(dfloatBenchmark_t *result);
+
+typedef struct {
+	uint16_t divSmallRef;	// per word
+	uint16_t divSmall;
+	uint16_t mulSmallRef;	// per word
+	uint16_t mulSmall;
+	uint16_t mulModRef;		// per call
+	uint16_t mulMod;
+	uint16_t spigotRef;		// per remainder term
+	uint16_t spigot;
+} multiwordBenchmark_t;
+
+// Cycles of the C reference and of the kernel actually used for mwDivSmall,
+// mwMulSmall, mwMulMod and spigotPass. Without PI_MULTIWORD_ASM both run
+// the same C code and the columns only differ by the wrapper call.
+void vBenchmarkMultiword(multiwordBenchmark_t *result);
+
+#endif /* BENCHMARK_H_ */
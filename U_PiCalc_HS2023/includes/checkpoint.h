@@ -0,0 +1,60 @@
+/*
+ * checkpoint.h
+ *
+ * Created: 16.10.2026
+ *
+ * Checkpoint records in an nvStore. Every owner gets a ring of fixed size
+ * slots and each save goes to the slot after the newest record, so the
+ * erase cycles spread over all slots and a write torn by a reset never
+ * destroys the last good record. A record is
+ *
+ *   magic, id, length, sequence (4 bytes LE), payload, CRC-16 (LE)
+ *
+ * with the CCITT CRC over everything before it. Plain C, the host tools
+ * use it with a file backed store.
+ */
+
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "nvStore.h"
+
+#define CHECKPOINT_MAGIC		0xC5
+#define CHECKPOINT_HEADER_BYTES	7
+// Bytes a record needs besides its payload
+#define CHECKPOINT_OVERHEAD		(CHECKPOINT_HEADER_BYTES + 2)
+
+typedef struct {
+	uint8_t id;
+	uint8_t length;		// payload bytes
+	uint32_t sequence;
+} checkpointHeader_t;
+
+typedef struct {
+	const nvStore_t *store;
+	uint16_t base;		// address of the first slot
+	uint8_t slots;
+	uint8_t slotSize;
+	uint8_t id;			// owner of the records, the caller may fold a version into it
+	uint8_t newest;		// slot of the newest valid record, slots if there is none
+	uint32_t sequence;	// sequence of the newest record
+} checkpointRing_t;
+
+// Scans the ring for its newest valid record
+void checkpointRingInit(checkpointRing_t *ring, const nvStore_t *store, uint16_t base, uint8_t slots, uint8_t slotSize, uint8_t id);
+
+// Reads the newest record into head and body. False if there is none or its
+// length differs, head and body are untouched then.
+bool checkpointLoad(const checkpointRing_t *ring, void *head, uint8_t headLength, void *body, uint8_t bodyLength);
+
+// Writes head and body as a new record into the next slot. False if they do
+// not fit a slot.
+bool checkpointSave(checkpointRing_t *ring, const void *head, uint8_t headLength, const void *body, uint8_t bodyLength);
+
+// Checks the record in the slot at address and returns its header
+bool checkpointRecordValid(const nvStore_t *store, uint16_t address, uint8_t slotSize, checkpointHeader_t *header);
+
+#endif /* CHECKPOINT_H_ */
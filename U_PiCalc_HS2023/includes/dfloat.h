@@ -0,0 +1,45 @@
+/*
+ * dfloat.h
+ *
+ * Created: 16.10.2026
+ *
+ * Double-float arithmetic. avr-gcc maps double onto the same 32-bit float,
+ * so a value is kept as the unevaluated sum hi + lo of two floats, which
+ * gives about 48 significant bits (~14 decimal digits). Based on the
+ * error-free transformations of Dekker and Knuth (two-sum, two-product).
+ */
+
+
+#ifndef DFLOAT_H_
+#define DFLOAT_H_
+
+#include <stdint.h>
+
+typedef struct {
+	float hi;	// leading part, the value rounded to float
+	float lo;	// trailing part, |lo| <= ulp(hi) / 2
+} dfloat_t;
+
+#define DFLOAT_PI_HI	3.14159274101257324f
+#define DFLOAT_PI_LO	-8.74227765734758577e-8f
+
+dfloat_t dfFromFloat(float value);
+dfloat_t dfFromUint32(uint32_t value);
+float dfToFloat(dfloat_t value);
+
+dfloat_t dfAdd(dfloat_t a, dfloat_t b);
+dfloat_t dfSub(dfloat_t a, dfloat_t b);
+dfloat_t dfNeg(dfloat_t a);
+dfloat_t dfAbs(dfloat_t a);
+dfloat_t dfMul(dfloat_t a, dfloat_t b);
+dfloat_t dfMulFloat(dfloat_t a, float b);
+dfloat_t dfDiv(dfloat_t a, dfloat_t b);
+
+// Returns -1, 0 or 1 for a < b, a == b, a > b
+int8_t dfCompare(dfloat_t a, dfloat_t b);
+
+// Writes the value with a fixed number of correctly rounded decimals (max 9).
+// The value must be smaller than 4 in magnitude for 9 decimals (uint32 range).
+void dfToDecimalString(char *buffer, dfloat_t value, uint8_t decimals);
+
+#endif /* DFLOAT_H_ */
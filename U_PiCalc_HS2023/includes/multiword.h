@@ -0,0 +1,67 @@
+/*
+ * multiword.h
+ *
+ * Created: 16.10.2026
+ *
+ * Multi-word fixed-point numbers for the many-digits engines. A number is an
+ * array of 16-bit words, most significant first. Word 0 is the integer part,
+ * the remaining words are the binary fraction (16 bits each).
+ */
+
+
+#ifndef MULTIWORD_H_
+#define MULTIWORD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "piCalcConfig.h"
+
+typedef uint16_t mword_t;
+
+#define MWORD_BITS	16
+
+void mwSetInt(mword_t *a, uint16_t n, uint16_t value);
+void mwCopy(mword_t *dst, const mword_t *src, uint16_t n);
+bool mwIsZero(const mword_t *a, uint16_t n);
+
+// Number of leading zero words
+uint16_t mwLeadingZeroWords(const mword_t *a, uint16_t n);
+
+// dst = src / divisor, truncated; dst may equal src. Returns the remainder.
+uint16_t mwDivSmall(mword_t *dst, const mword_t *src, uint16_t n, uint16_t divisor);
+
+// a *= factor. Returns the overflow out of the integer word.
+uint16_t mwMulSmall(mword_t *a, uint16_t n, uint16_t factor);
+
+// a * b mod m for a, b < m
+uint16_t mwMulMod(uint16_t a, uint16_t b, uint16_t m);
+
+// C versions of the three kernels above. With PI_MULTIWORD_ASM the kernels
+// are the assembly ones in multiwordAvr.S and these serve as reference.
+uint16_t mwDivSmallRef(mword_t *dst, const mword_t *src, uint16_t n, uint16_t divisor);
+uint16_t mwMulSmallRef(mword_t *a, uint16_t n, uint16_t factor);
+uint16_t mwMulModRef(uint16_t a, uint16_t b, uint16_t m);
+
+// dst += src resp. dst -= src, wrapping modulo the integer word
+void mwAdd(mword_t *dst, const mword_t *src, uint16_t n);
+void mwSub(mword_t *dst, const mword_t *src, uint16_t n);
+
+// dst = a * b, truncated to n words; dst may equal a and/or b
+void mwMul(mword_t *dst, const mword_t *a, const mword_t *b, uint16_t n);
+
+// floor(sqrt(x)) by integer Newton iteration, seeds the multi-word roots
+uint16_t mwIsqrt32(uint32_t x);
+
+// dst = 1 / x for 1/4 <= x < 4 by Newton iteration y = y(2 - xy).
+// scratch must hold 2n words; dst must not overlap x or scratch.
+void mwReciprocal(mword_t *dst, const mword_t *x, uint16_t n, mword_t *scratch);
+
+// dst = sqrt(x) for 1/16 <= x < 4, via 1/sqrt(x) with y = y(3 - xy^2)/2.
+// Division free; scratch must hold 3n words, dst may equal x.
+void mwSqrt(mword_t *dst, const mword_t *x, uint16_t n, mword_t *scratch);
+
+// Writes the integer word and count decimals ("3.1415..."), the integer
+// word must be below 10. scratch must hold n words.
+void mwFormat(char *buffer, const mword_t *a, uint16_t n, uint16_t count, mword_t *scratch);
+
+#endif /* MULTIWORD_H_ */
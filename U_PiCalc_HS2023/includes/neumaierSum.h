@@ -0,0 +1,24 @@
+/*
+ * neumaierSum.h
+ *
+ * Created: 16.10.2026
+ *
+ * Compensated (Neumaier) float accumulator. Keeps the low-order bits that a
+ * plain float sum drops when small series terms are added to a value near pi,
+ * so long runs keep converging instead of stalling at the float resolution.
+ */
+
+
+#ifndef NEUMAIERSUM_H_
+#define NEUMAIERSUM_H_
+
+typedef struct {
+	float sum;			// running sum, as a plain float accumulator would hold it
+	float compensation;	// accumulated rounding error of sum
+} neumaierSum_t;
+
+void neumaierInit(neumaierSum_t *accumulator, float value);
+void neumaierAdd(neumaierSum_t *accumulator, float term);
+float neumaierValue(const neumaierSum_t *accumulator);
+
+#endif /* NEUMAIERSUM_H_ */
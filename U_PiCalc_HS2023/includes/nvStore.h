@@ -0,0 +1,26 @@
+/*
+ * nvStore.h
+ *
+ * Created: 16.10.2026
+ *
+ * Byte addressed non-volatile storage. The checkpoints only use this
+ * interface, so the firmware backs it with the XMEGA EEPROM and the host
+ * tools with a file holding an EEPROM image.
+ */
+
+
+#ifndef NVSTORE_H_
+#define NVSTORE_H_
+
+#include <stdint.h>
+
+typedef struct {
+	void (*read)(uint16_t address, void *data, uint16_t length);
+	// Only bytes that differ are written, unchanged pages cost no erase cycle
+	void (*write)(uint16_t address, const void *data, uint16_t length);
+	uint16_t size;		// bytes, erased bytes read as 0xFF
+} nvStore_t;
+
+extern const nvStore_t nvStoreEeprom;
+
+#endif /* NVSTORE_H_ */
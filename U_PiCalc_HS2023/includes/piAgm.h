@@ -0,0 +1,62 @@
+/*
+ * piAgm.h
+ *
+ * Created: 16.10.2026
+ *
+ * Gauss-Legendre (arithmetic-geometric mean) iteration over multi-word fixed
+ * point. Every iteration roughly doubles the number of correct digits, so a
+ * few iterations replace thousands of series terms. The square roots and the
+ * final division are Newton iterations built from multi-word products only.
+ */
+
+
+#ifndef PIAGM_H_
+#define PIAGM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "multiword.h"
+
+// The last words absorb the truncation error of the Newton iterations
+#define AGM_GUARD_WORDS			2
+
+// Buffer words needed for a number length of n words
+#define AGM_BUFFER_WORDS(n)		(8 * (n))
+
+// frac(pi) * 2^32, reference for the accuracy milestone
+#define AGM_PI_FRACTION_Q32		0x243F6A88UL
+
+typedef struct {
+	mword_t *a;			// arithmetic mean
+	mword_t *b;			// geometric mean
+	mword_t *t;			// t -= p * (a - a')^2
+	mword_t *pi;		// (a + b)^2 / (4t) of the current iteration
+	mword_t *scratch;	// 4 numbers for the products and Newton steps
+	uint16_t words;		// words per number, integer word included
+	uint16_t p;			// 2^iteration
+	uint16_t matchingWords;	// leading fraction words where a and b agree
+	uint8_t iterations;
+	bool done;
+} agmState_t;
+
+// buffer must hold AGM_BUFFER_WORDS(words) words
+void agmInit(agmState_t *state, mword_t *buffer, uint16_t words);
+
+// One AGM iteration and a new pi estimate. Returns false once a and b agree
+// to the full precision, i.e. the estimate no longer changes.
+bool agmStep(agmState_t *state);
+
+// Decimal digits after the point of the current estimate that are correct
+uint16_t agmDigits(const agmState_t *state);
+
+// Maximum number of correct digits for the array length
+uint16_t agmDigitsTotal(const agmState_t *state);
+
+// |estimate - pi| in units of 2^-32, saturated; for the accuracy milestone
+uint32_t agmErrorQ32(const agmState_t *state);
+
+// Writes "3." and the leading decimals (count digits). Uses the scratch
+// numbers, so it must only be called between two steps.
+void agmFormat(agmState_t *state, char *buffer, uint16_t count);
+
+#endif /* PIAGM_H_ */
@@ -0,0 +1,54 @@
+/*
+ * piBbp.h
+ *
+ * Created: 16.10.2026
+ *
+ * Bailey-Borwein-Plouffe digit extraction: hex digit n of pi is computed
+ * directly from frac(16^(n-1) * pi) with modular exponentiation, without
+ * the digits before it. Memory use is constant, the work is O(n log n).
+ */
+
+
+#ifndef PIBBP_H_
+#define PIBBP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Width of the residues and moduli of the modular exponentiation. On the
+// AVR they stay below 2^16, so every product fits the 32 bits of mwMulMod;
+// the host build uses 32-bit residues with 64-bit products.
+#ifndef BBP_RESIDUE_BITS
+#ifdef __AVR__
+#define BBP_RESIDUE_BITS	16
+#else
+#define BBP_RESIDUE_BITS	32
+#endif
+#endif
+
+#if (BBP_RESIDUE_BITS == 16)
+// Largest modulus 8k+6 with k < n must stay below 2^16
+#define BBP_MAX_POSITION	8190UL
+#else
+#define BBP_MAX_POSITION	500000000UL
+#endif
+
+typedef struct {
+	uint32_t position;	// hex digit index, 1 is the first digit after the point
+	uint32_t k;			// next term index
+	uint32_t sums[4];	// frac(S1), frac(S4), frac(S5), frac(S6) as Q0.32
+	bool done;
+} bbpState_t;
+
+void bbpInit(bbpState_t *state, uint32_t position);
+
+// Adds term k of all four series. Returns false once the digit is known.
+bool bbpStep(bbpState_t *state);
+
+// frac(16^(n-1) * pi) as Q0.32, valid once bbpStep returned false
+uint32_t bbpFraction(const bbpState_t *state);
+
+// Hex digit n (0..15), valid once bbpStep returned false
+uint8_t bbpDigit(const bbpState_t *state);
+
+#endif /* PIBBP_H_ */
@@ -0,0 +1,272 @@
+/*
+ * piCalcConfig.h
+ *
+ * Created: 16.10.2026
+ *
+ * Build-time options of the pi calculator. Every option can be overridden
+ * from the compiler command line (-D...) or by editing the default below.
+ */
+
+
+#ifndef PICALCCONFIG_H_
+#define PICALCCONFIG_H_
+
+/*---------------------------------------------------------------------------------*/
+// Number format used by the Leibniz and Nilkantha engines.
+//  PI_NUMERIC_FLOAT   : soft-float accumulator (original implementation)
+//  PI_NUMERIC_FIXED32 : Q2.29 fixed point, 32-bit integer add / divide only
+//  PI_NUMERIC_FIXED64 : Q2.61 fixed point, slower but ~1e-18 resolution
+//  PI_NUMERIC_DFLOAT  : double-float (hi + lo), ~48 bits, shows 8 real decimals
+/*---------------------------------------------------------------------------------*/
+#define PI_NUMERIC_FLOAT	0
+#define PI_NUMERIC_FIXED32	1
+#define PI_NUMERIC_FIXED64	2
+#define PI_NUMERIC_DFLOAT	3
+
+#ifndef PI_NUMERIC_MODE
+#define PI_NUMERIC_MODE		PI_NUMERIC_FIXED32
+#endif
+
+#if (PI_NUMERIC_MODE == PI_NUMERIC_FLOAT)
+#define PI_NUMERIC_NAME		"FLT"
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED32)
+#define PI_NUMERIC_NAME		"FX32"
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_FIXED64)
+#define PI_NUMERIC_NAME		"FX64"
+#elif (PI_NUMERIC_MODE == PI_NUMERIC_DFLOAT)
+#define PI_NUMERIC_NAME		"DFLT"
+#else
+#error PI_NUMERIC_MODE must be PI_NUMERIC_FLOAT, PI_NUMERIC_FIXED32, PI_NUMERIC_FIXED64 or PI_NUMERIC_DFLOAT !
+#endif
+
+/*---------------------------------------------------------------------------------*/
+// Summation of the float engines (only used with PI_NUMERIC_FLOAT).
+//  PI_SUM_PLAIN    : pi += term, stalls once the terms drop below the float ulp
+//  PI_SUM_NEUMAIER : compensated summation, keeps converging on long runs
+/*---------------------------------------------------------------------------------*/
+#define PI_SUM_PLAIN		0
+#define PI_SUM_NEUMAIER		1
+
+#ifndef PI_LEIBNIZ_SUMMATION
+#define PI_LEIBNIZ_SUMMATION	PI_SUM_NEUMAIER
+#endif
+
+#ifndef PI_NILKANTHA_SUMMATION
+#define PI_NILKANTHA_SUMMATION	PI_SUM_NEUMAIER
+#endif
+
+/*---------------------------------------------------------------------------------*/
+// Acceleration stage of the Leibniz and Nilkantha engines. The extrapolated
+// estimate is shown next to the raw partial sum.
+//  PI_ACCEL_NONE   : raw partial sums only
+//  PI_ACCEL_AITKEN : Aitken delta-squared, Leibniz reaches 1e-5 after ~31 terms
+//  PI_ACCEL_EULER  : Euler transform of the last partial sums, Leibniz reaches
+//                    1e-5 after 11 terms
+/*---------------------------------------------------------------------------------*/
+#define PI_ACCEL_NONE		0
+#define PI_ACCEL_AITKEN		1
+#define PI_ACCEL_EULER		2
+
+#ifndef PI_ACCELERATION
+#define PI_ACCELERATION		PI_ACCEL_EULER
+#endif
+
+#if (PI_ACCELERATION == PI_ACCEL_AITKEN)
+#define PI_ACCEL_NAME		"A"
+#define PI_ACCELERATE		accelAitken
+#elif (PI_ACCELERATION == PI_ACCEL_EULER)
+#define PI_ACCEL_NAME		"E"
+#define PI_ACCELERATE		accelEuler
+#elif (PI_ACCELERATION != PI_ACCEL_NONE)
+#error PI_ACCELERATION must be PI_ACCEL_NONE, PI_ACCEL_AITKEN or PI_ACCEL_EULER !
+#endif
+
+/*---------------------------------------------------------------------------------*/
+// Batch execution of the engines. A running engine computes terms until
+// PI_BATCH_TICKS ticks have passed, then sleeps PI_BATCH_REST_TICKS so the
+// display and idle task get the CPU. Start/Stop/Reset are only checked
+// between batches, so the command latency is bounded by the sum of both.
+// PI_BATCH_TICKS 0 falls back to one term per batch and a 10 ms rest.
+/*---------------------------------------------------------------------------------*/
+#ifndef PI_BATCH_TICKS
+#define PI_BATCH_TICKS			8
+#endif
+
+#ifndef PI_BATCH_REST_TICKS
+#if (PI_BATCH_TICKS > 0)
+#define PI_BATCH_REST_TICKS		1
+#else
+#define PI_BATCH_REST_TICKS		pdMS_TO_TICKS(10)
+#endif
+#endif
+
+// Idle compute mode: no worker task, the idle hook runs the engines on the
+// idle task's stack instead, so the UI tasks preempt them at any time. The
+// time the worker would rest goes into the engines as well; the steps won
+// that way are sent as telemetry.
+#ifndef PI_IDLE_COMPUTE
+#define PI_IDLE_COMPUTE			0
+#endif
+
+// Spigot engine: the remainder array takes the heap that is left once all
+// tasks exist, minus a small reserve. Its length is capped so that the
+// denominators 2i-1 still fit into 16 bits.
+#ifndef PI_SPIGOT_HEAP_RESERVE
+#define PI_SPIGOT_HEAP_RESERVE		64
+#endif
+#define PI_SPIGOT_MAX_LENGTH		32767U
+
+// Machin engine: words (16 bit) per multi-word number, integer word included.
+// Three numbers are allocated from the heap; 64 words give 298 digits.
+#ifndef PI_MACHIN_WORDS
+#define PI_MACHIN_WORDS				64
+#endif
+
+// Gauss-Legendre engine: words per multi-word number, integer word included.
+// Eight numbers are allocated from the heap; 32 words give 139 digits.
+#ifndef PI_AGM_WORDS
+#define PI_AGM_WORDS				32
+#endif
+
+// Ramanujan engine: words per multi-word number, integer word included.
+// Eight numbers are allocated from the heap; 32 words give 139 digits after
+// 18 terms. Up to 256 words the combined divisor 396(k+1) of the term
+// recurrence stays below 2^16 for every term the numbers can resolve.
+#ifndef PI_RAMANUJAN_WORDS
+#define PI_RAMANUJAN_WORDS			32
+#endif
+#define PI_RAMANUJAN_MAX_WORDS		256
+#if (PI_RAMANUJAN_WORDS > PI_RAMANUJAN_MAX_WORDS)
+#error "PI_RAMANUJAN_WORDS beyond the 16-bit divisors of the Ramanujan engine"
+#endif
+
+// Assembly kernels (multiwordAvr.S) for the inner loops of the many-digits
+// engines: multi-word divide and multiply by a small integer, the BBP
+// modular product and the spigot pass. 0, and every build for another CPU,
+// uses the C reference versions instead. Off until the startup benchmark
+// has confirmed the kernels on the target, their cycles are modelled only.
+#ifndef PI_MULTIWORD_ASM
+#define PI_MULTIWORD_ASM			0
+#endif
+#ifndef __AVR__
+#undef PI_MULTIWORD_ASM
+#define PI_MULTIWORD_ASM			0
+#endif
+
+// Interval engine: the run finishes once the width of the enclosure proves
+// this many decimals. Rounding widens it by up to 2^-61 per term, so Q2.61
+// can certify at most 13 decimals with the Nilkantha series. Leibniz stops
+// at 8: its width 4/(2n+1) plus n * 2^-59 of rounding never falls below
+// 3.7e-9, 8 decimals take 207466670 terms.
+#ifndef PI_INTERVAL_DIGITS
+#define PI_INTERVAL_DIGITS			12
+#endif
+#define PI_INTERVAL_MAX_DIGITS		13
+#define PI_INTERVAL_LEIBNIZ_DIGITS	8
+#if (PI_INTERVAL_DIGITS > PI_INTERVAL_MAX_DIGITS)
+#error "PI_INTERVAL_DIGITS beyond the resolution of the interval engine"
+#endif
+
+// Monte Carlo engine: points per step, and the decimals its 95 % confidence
+// interval must prove before the run stops. Each point takes one output of
+// a 32-bit generator with period 2^32 - 1, and 4 decimals already need about
+// 1.04e9 points, so more is out of reach.
+#ifndef PI_MONTECARLO_BATCH
+#define PI_MONTECARLO_BATCH			4096
+#endif
+#ifndef PI_MONTECARLO_DIGITS
+#define PI_MONTECARLO_DIGITS		3
+#endif
+#define PI_MONTECARLO_MAX_DIGITS	4
+#if (PI_MONTECARLO_DIGITS > PI_MONTECARLO_MAX_DIGITS)
+#error "PI_MONTECARLO_DIGITS beyond the sample count of the Monte Carlo engine"
+#endif
+
+// Checkpoints: while they run, the engines with a checkpointSize save their
+// state, elapsed time and milestones to the EEPROM every PI_CHECKPOINT_MS
+// and on Start/Stop/Reset. Each engine gets a ring of PI_CHECKPOINT_SLOTS
+// records for wear levelling; 3 engines x 4 x 168 bytes use 2016 of the
+// 2048 bytes. A new PI_CHECKPOINT_VERSION ignores older records.
+#ifndef PI_CHECKPOINT
+#define PI_CHECKPOINT				1
+#endif
+#ifndef PI_CHECKPOINT_MS
+#define PI_CHECKPOINT_MS			60000
+#endif
+#define PI_CHECKPOINT_SLOTS			4
+#define PI_CHECKPOINT_SLOT_BYTES	168
+#define PI_CHECKPOINT_VERSION		1
+
+// CPU time per task: FreeRTOS run-time statistics on Timer/Counter TCD0.
+// A long press of Reset shows the share of every task and sends the totals
+// as telemetry. Costs a counter read per context switch.
+#ifndef PI_RUNTIME_STATS
+#define PI_RUNTIME_STATS			1
+#endif
+
+// Scheduler trace: context switches, queue traffic, event group bits and
+// task notifications go into a ring of PI_TRACE_EVENTS events (4 bytes
+// each) from the heap, timestamped by the run-time statistics counter. The
+// long press of Reset sends it along with the CPU totals.
+#ifndef PI_TRACE
+#define PI_TRACE					0
+#endif
+#ifndef PI_TRACE_EVENTS
+#define PI_TRACE_EVENTS				256
+#endif
+#if (PI_TRACE == 1 && PI_RUNTIME_STATS == 0)
+#error "PI_TRACE needs the time base of PI_RUNTIME_STATS"
+#endif
+
+// Run the float vs. double-float throughput benchmark once at startup
+// and show its result for a few seconds before the normal display.
+#ifndef PI_BENCHMARK_AT_STARTUP
+#define PI_BENCHMARK_AT_STARTUP		0
+#endif
+
+// Convergence milestones: every engine records run time and step count of
+// the first PI_MILESTONE_DECADES decades (1e-1, 1e-2, ...) its error falls
+// below. Engines with a deeper floor keep only the first decades: the
+// series in DFLT (14) and FX64 (18) and the digit engines drop the rest.
+// Each decade costs 8 bytes per engine, so 10 keeps the RAM budget.
+#ifndef PI_MILESTONE_DECADES
+#define PI_MILESTONE_DECADES		10
+#endif
+
+// Telemetry: milestones are sent as text lines on a USART, 115200 8N1
+#ifndef PI_TELEMETRY
+#define PI_TELEMETRY				1
+#endif
+#ifndef PI_TELEMETRY_USART
+#define PI_TELEMETRY_USART			USARTC0
+#define PI_TELEMETRY_PORT			PORTC
+#define PI_TELEMETRY_TX_PIN			PIN3_bm
+#endif
+
+// Race mode: the leaderboard shows three places per page and turns the
+// page after this many milliseconds
+#ifndef PI_RACE_PAGE_MS
+#define PI_RACE_PAGE_MS			2000
+#endif
+
+// Display: the controller sleeps until a button or new values of the shown
+// engine and redraws then, at most once per PI_DISPLAY_MIN_MS (the refresh
+// period of the display task). While a clock runs or pages turn it also
+// redraws every PI_DISPLAY_PERIOD_MS, which is the period of the step rates.
+#ifndef PI_DISPLAY_PERIOD_MS
+#define PI_DISPLAY_PERIOD_MS		500
+#endif
+#ifndef PI_DISPLAY_MIN_MS
+#define PI_DISPLAY_MIN_MS			200
+#endif
+
+// Accuracy target of the engines (absolute error against pi), a power of
+// ten, and the correct decimals that meet it
+#define PI_ACCURACY_TARGET	0.00001
+#define PI_ACCURACY_DIGITS	5
+
+#if (PI_MILESTONE_DECADES < PI_ACCURACY_DIGITS)
+#error PI_MILESTONE_DECADES must cover the accuracy target !
+#endif
+
+#endif /* PICALCCONFIG_H_ */
@@ -0,0 +1,102 @@
+/*
+ * piEngine.h
+ *
+ * Created: 16.10.2026
+ *
+ * Descriptor of a pi engine. All engines are listed in one registry and run
+ * by a single worker task, so an engine costs only its state, not a task
+ * with its own stack. The worker owns the generic run bookkeeping (running
+ * flag, timing, step count), the engine only computes and formats.
+ */
+
+
+#ifndef PIENGINE_H_
+#define PIENGINE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "piCalcConfig.h"
+
+// step() returns the correct decimals of the estimate so far (the largest d
+// with an error below 10^-d), ORed with PI_STEP_FINISHED once nothing is
+// left to compute until the next init()
+#define PI_STEP_DECIMALS	0x7FFF
+#define PI_STEP_FINISHED	0x8000
+
+// Display lines an engine fills (the fourth one holds the button legend)
+#define PI_ENGINE_LINES		3
+#define PI_ENGINE_LINE_SIZE	21
+
+// Run time and step count at which the error first fell below a decade
+typedef struct {
+	TickType_t time;
+	uint32_t steps;
+} piMilestone_t;
+
+// Run bookkeeping of one engine, kept by the worker and published in
+// critical sections, read it the same way. The controller only measures the
+// rate. A checkpoint holds everything before startTime.
+typedef struct {
+	bool running;
+	bool clockStopped;		// accurate resp. finished, the elapsed time is frozen
+	bool finished;
+	TickType_t elapsedTime;
+	uint32_t steps;			// steps since the last init()
+	uint16_t decimals;		// correct decimals reached so far
+	uint8_t decades;		// milestones recorded, entry d is the error 10^-(d+1)
+	piMilestone_t milestones[PI_MILESTONE_DECADES];
+	TickType_t startTime;
+	uint32_t rate;			// steps per second, measured by the controller
+	uint8_t commands;		// commands applied, counts up and wraps
+	uint8_t command;		// mailbox bits of the last command
+	TickType_t commandLatency;	// ticks from sending the last command to its effect
+	uint32_t restSteps;		// idle compute mode: steps run in place of the rests
+} piEngineStatus_t;
+
+typedef struct {
+	const char *name;
+	void *state;
+	// The engine approximates pi as a whole: its decimals are milestones and
+	// it takes part in races
+	bool estimatesPi;
+	// Its decimals are a confidence bound, not verified digits: the race
+	// lists it after the ranked engines, unranked
+	bool statistical;
+	// The elapsed time stops at PI_ACCURACY_TARGET instead of the end of the run
+	bool clockToAccuracy;
+	// Optional, called once from main() before the scheduler starts (heap buffers)
+	void (*setup)(void *state);
+	// Back to the first term; called by the worker at startup and on Reset
+	void (*init)(void *state);
+	// Optional, called on Start; returns true if the engine started over
+	bool (*start)(void *state);
+	// One term or iteration, returns the decimals and PI_STEP_FINISHED
+	uint16_t (*step)(void *state);
+	// Optional, called after every batch to publish the result for the display
+	void (*batch)(void *state);
+	// Formats the display page, runs in the controller task
+	void (*result)(void *state, const piEngineStatus_t *status, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE]);
+	// Optional, long press of button 1 or 2 while the engine is selected.
+	// The press travels through the engine's parameter word and this runs
+	// in the worker between two batches, like the commands.
+	void (*longPress)(void *state, uint8_t button);
+	// Optional, closed-form steps until the error falls below 10^-decimals,
+	// 0 if the engine cannot get there
+	uint32_t (*stepsFor)(void *state, uint16_t decimals);
+	// Optional, bytes at the start of state that hold the whole run without
+	// pointers; they are checkpointed to the EEPROM as they are
+	uint8_t checkpointSize;
+} piEngine_t;
+
+extern const piEngine_t piEngineLeibniz;
+extern const piEngine_t piEngineNilkantha;
+extern const piEngine_t piEngineSpigot;
+extern const piEngine_t piEngineMachin;
+extern const piEngine_t piEngineBbp;
+extern const piEngine_t piEngineAgm;
+extern const piEngine_t piEngineInterval;
+extern const piEngine_t piEngineMonteCarlo;
+extern const piEngine_t piEngineRamanujan;
+
+#endif /* PIENGINE_H_ */
@@ -0,0 +1,55 @@
+/*
+ * piFixed.h
+ *
+ * Created: 16.10.2026
+ *
+ * Fixed-point series kernels for the Leibniz and Nilkantha engines.
+ * The XMEGA has no FPU, but it has a 8x8 hardware multiplier, so the
+ * series terms are built from integer products and one integer division
+ * of a fixed-point one (reciprocal) instead of soft-float operations.
+ */
+
+
+#ifndef PIFIXED_H_
+#define PIFIXED_H_
+
+#include <stdint.h>
+
+/*---------------------------------------------------------------------------------*/
+// Q2.29: signed 32-bit, 29 fractional bits, range [-4, 4), resolution 1.9e-9
+/*---------------------------------------------------------------------------------*/
+typedef int32_t fixed32_t;
+
+#define FIXED32_FRAC_BITS		29
+#define FIXED32_ONE				((fixed32_t)1 << FIXED32_FRAC_BITS)
+#define FIXED32_PI				((fixed32_t)1686629713L)	// round(pi * 2^29)
+#define FIXED32_PI_QUARTER		((fixed32_t)421657428L)		// round(pi/4 * 2^29)
+#define FIXED32_THREE			((fixed32_t)3 * FIXED32_ONE)
+#define FIXED32_FROM_FLOAT(x)	((fixed32_t)((x) * (float)FIXED32_ONE + 0.5))
+
+/*---------------------------------------------------------------------------------*/
+// Q2.61: signed 64-bit, 61 fractional bits, range [-4, 4), resolution 4.3e-19
+/*---------------------------------------------------------------------------------*/
+typedef int64_t fixed64_t;
+
+#define FIXED64_FRAC_BITS		61
+#define FIXED64_ONE				((fixed64_t)1 << FIXED64_FRAC_BITS)
+#define FIXED64_PI				((fixed64_t)7244019458077122842LL)	// round(pi * 2^61)
+#define FIXED64_PI_QUARTER		((fixed64_t)1811004864519280711LL)	// round(pi/4 * 2^61)
+#define FIXED64_THREE			((fixed64_t)3 * FIXED64_ONE)
+#define FIXED64_FROM_FLOAT(x)	((fixed64_t)((x) * (float)FIXED64_ONE + 0.5))
+
+// Leibniz term 1/(2k+1). The Leibniz accumulator holds pi/4, since pi itself
+// would not fit into the first partial sum (4.0) of a signed Q2 number.
+fixed32_t fixed32LeibnizTerm(uint32_t k);
+fixed64_t fixed64LeibnizTerm(uint32_t k);
+
+// Nilkantha term 4/((2k+2)(2k+3)(2k+4)). Returns 0 once the term is smaller
+// than the resolution of the format; the engine has then reached its floor.
+fixed32_t fixed32NilkanthaTerm(uint32_t k);
+fixed64_t fixed64NilkanthaTerm(uint32_t k);
+
+float fixed32ToFloat(fixed32_t value);
+float fixed64ToFloat(fixed64_t value);
+
+#endif /* PIFIXED_H_ */
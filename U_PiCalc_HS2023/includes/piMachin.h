@@ -0,0 +1,53 @@
+/*
+ * piMachin.h
+ *
+ * Created: 16.10.2026
+ *
+ * Machin's formula pi = 16*arctan(1/5) - 4*arctan(1/239) over multi-word
+ * fixed point. Each series term costs two in-place divisions of a multi-word
+ * number by a small integer; the arctan(1/5) series gains ~1.4 digits per term.
+ */
+
+
+#ifndef PIMACHIN_H_
+#define PIMACHIN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "multiword.h"
+
+// The last word absorbs the truncation error of all divisions
+#define MACHIN_GUARD_WORDS		1
+
+// Buffer words needed for a number length of n words
+#define MACHIN_BUFFER_WORDS(n)	(3 * (n))
+
+typedef struct {
+	mword_t *sum;		// running value of pi
+	mword_t *power;		// c / x^(2k+1) of the current series
+	mword_t *term;		// power / (2k+1), also scratch for formatting
+	uint16_t words;		// words per number, integer word included
+	uint16_t k;			// term index within the current series
+	uint16_t x;			// current arctan argument, 239 first, then 5
+	uint16_t zeroWords;	// leading zero words of power, skipped by the divisions
+	uint16_t terms;		// series terms done in total
+	bool done;
+} machinState_t;
+
+// buffer must hold MACHIN_BUFFER_WORDS(words) words
+void machinInit(machinState_t *state, mword_t *buffer, uint16_t words);
+
+// Adds one series term. Returns false once both series are exhausted.
+bool machinStep(machinState_t *state);
+
+// Decimal digits after the point that are final so far
+uint16_t machinDigits(const machinState_t *state);
+
+// Maximum number of correct digits for the array length
+uint16_t machinDigitsTotal(const machinState_t *state);
+
+// Writes "3." and the leading decimals (count digits). Uses term as scratch,
+// so it must only be called between two steps.
+void machinFormat(machinState_t *state, char *buffer, uint16_t count);
+
+#endif /* PIMACHIN_H_ */
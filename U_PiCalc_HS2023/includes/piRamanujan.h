@@ -0,0 +1,61 @@
+/*
+ * piRamanujan.h
+ *
+ * Created: 16.10.2026
+ *
+ * Ramanujan's series 1/pi = 2*sqrt(2)/9801 * sum (4k)! (1103 + 26390k) /
+ * ((k!)^4 396^(4k)) over multi-word fixed point, about 8 digits per term.
+ * The factorial ratio t_k = (4k)! / ((k!)^4 396^(4k)) is carried from term
+ * to term with small multiplications and divisions, so no factorial is ever
+ * formed.
+ */
+
+
+#ifndef PIRAMANUJAN_H_
+#define PIRAMANUJAN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "multiword.h"
+
+// The last words absorb the truncation error of the recurrence and of the
+// final Newton division
+#define RAMANUJAN_GUARD_WORDS		2
+
+// Buffer words needed for a number length of n words
+#define RAMANUJAN_BUFFER_WORDS(n)	(8 * (n))
+
+typedef struct {
+	mword_t *t;			// factorial ratio t_k of the next term
+	mword_t *sum;		// sum of t_k
+	mword_t *sumK;		// sum of k * t_k
+	mword_t *constant;	// 9801 / (2 * sqrt(2) * 1024)
+	mword_t *pi;		// estimate from the terms so far
+	mword_t *scratch;	// 3 numbers for the estimate and formatting
+	uint16_t words;		// words per number, integer word included
+	uint16_t k;			// terms added so far
+	uint16_t zeroWords;	// leading zero words of t, skipped by the recurrence
+	bool done;
+} ramanujanState_t;
+
+// buffer must hold RAMANUJAN_BUFFER_WORDS(words) words
+void ramanujanInit(ramanujanState_t *state, mword_t *buffer, uint16_t words);
+
+// Adds one term and updates the estimate. Returns false once the terms
+// no longer reach the last word.
+bool ramanujanStep(ramanujanState_t *state);
+
+// Decimal digits after the point of the current estimate that are correct
+uint16_t ramanujanDigits(const ramanujanState_t *state);
+
+// Maximum number of correct digits for the array length
+uint16_t ramanujanDigitsTotal(const ramanujanState_t *state);
+
+// Terms after which ramanujanDigits() reaches digits
+uint16_t ramanujanTermsFor(uint16_t digits);
+
+// Writes "3." and the leading decimals (count digits). Uses the scratch
+// numbers, so it must only be called between two steps.
+void ramanujanFormat(ramanujanState_t *state, char *buffer, uint16_t count);
+
+#endif /* PIRAMANUJAN_H_ */
@@ -0,0 +1,45 @@
+/*
+ * piReference.h
+ *
+ * Created: 16.10.2026
+ *
+ * Reference decimals of pi in flash, to verify the digits the many-digits
+ * engines produce. M_PI is only a 32-bit float on AVR and cannot check
+ * anything beyond the seventh decimal. The table is read with ELPM, so it
+ * may be placed anywhere in the 128 KB flash (config24BITADDRESSING).
+ */
+
+
+#ifndef PIREFERENCE_H_
+#define PIREFERENCE_H_
+
+#include <stdint.h>
+#include "multiword.h"
+
+// Decimals after "3." in the table
+#define PI_REFERENCE_DIGITS		4096
+
+// Leading decimals confirmed so far. Digits before verified are not compared
+// again, so every check only costs the digits that are new since the last one.
+typedef struct {
+	uint16_t verified;
+	uint16_t checked;	// count of the last multi-word check
+} piVerify_t;
+
+// Decimal index (0 = the 1 after "3.") of the reference, as a number 0-9
+uint8_t piReferenceDigit(uint16_t index);
+
+void piVerifyInit(piVerify_t *verify);
+
+// Checks one digit of a stream, index counted like piReferenceDigit(). Only
+// the digit right after the verified ones counts, so a wrong digit stops the
+// count for the rest of the stream. Returns the verified decimals.
+uint16_t piVerifyDigit(piVerify_t *verify, uint16_t index, char digit);
+
+// Checks the decimals of the multi-word number a (integer word 3) up to count.
+// The conversion still runs over the verified ones, the compare starts after
+// them, and nothing happens until count grows past the last check. scratch
+// must hold n words. Returns the verified decimals.
+uint16_t piVerifyMultiword(piVerify_t *verify, const mword_t *a, uint16_t n, uint16_t count, mword_t *scratch);
+
+#endif /* PIREFERENCE_H_ */
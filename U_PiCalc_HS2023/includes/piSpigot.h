@@ -0,0 +1,48 @@
+/*
+ * piSpigot.h
+ *
+ * Created: 16.10.2026
+ *
+ * Rabinowitz-Wagon decimal spigot for pi. The number is held in a mixed-radix
+ * remainder array of uint16 values; every step multiplies it by 10 and
+ * releases the next decimal digit. Runs of 9s are held back until the
+ * following digit decides whether they carry, so released digits are final.
+ */
+
+
+#ifndef PISPIGOT_H_
+#define PISPIGOT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Remainder terms needed per decimal digit is 10/3
+#define SPIGOT_LENGTH_FOR_DIGITS(n)	((uint16_t)(((uint32_t)(n) * 10) / 3 + 1))
+#define SPIGOT_DIGITS_FOR_LENGTH(l)	((uint16_t)(((uint32_t)(l) - 1) * 3 / 10))
+
+typedef void (*spigotEmit_t)(char digit);
+
+typedef struct {
+	uint16_t *remainders;	// remainder array, allocated by the caller
+	uint16_t length;		// number of remainder terms
+	uint16_t digitsTotal;	// digits the array can produce
+	uint16_t digitsComputed;// outer iterations done so far
+	uint16_t digitsEmitted;	// digits released through the emit callback
+	uint16_t nines;			// held back run of 9s
+	int8_t predigit;		// held back digit, -1 before the first one
+} spigotState_t;
+
+void spigotInit(spigotState_t *state, uint16_t *remainders, uint16_t length);
+
+// One pass over the first active terms: each remainder times 10 plus the
+// carry from above, reduced modulo 2i-1. Returns the carry out of term 1.
+// spigotPassRef is the C version, with PI_MULTIWORD_ASM spigotPass is the
+// assembly kernel in multiwordAvr.S.
+uint16_t spigotPass(uint16_t *remainders, uint16_t active);
+uint16_t spigotPassRef(uint16_t *remainders, uint16_t active);
+
+// Computes one more digit and emits every digit that became final.
+// Returns false once all digits of the array have been emitted.
+bool spigotStep(spigotState_t *state, spigotEmit_t emit);
+
+#endif /* PISPIGOT_H_ */
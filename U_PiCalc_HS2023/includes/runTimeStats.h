@@ -0,0 +1,46 @@
+/*
+ * runTimeStats.h
+ *
+ * Created: 16.10.2026
+ *
+ * Time base of the FreeRTOS run-time statistics and the CPU share per task.
+ * Timer/Counter TCD0 counts the CPU clock / 64 (2 us) and its overflow
+ * interrupt carries into a 16-bit software word, so the counter has 32 bits
+ * and wraps after 2.4 hours. The kernel reads it at every context switch.
+ */
+
+
+#ifndef RUNTIMESTATS_H_
+#define RUNTIMESTATS_H_
+
+#include <stdint.h>
+
+// Counter ticks per millisecond
+#define RUNTIME_STATS_TICKS_PER_MS	500UL
+
+// Tasks the statistics cover, more are left out
+#define RUNTIME_STATS_MAX_TASKS		8
+
+typedef struct {
+	const char *name;	// FreeRTOS task name
+	uint32_t time;		// counter ticks since the start of the scheduler
+	uint8_t percent;	// CPU share since the previous sample
+} runTimeTask_t;
+
+typedef struct {
+	runTimeTask_t tasks[RUNTIME_STATS_MAX_TASKS];	// in creation order
+	uint8_t count;
+	uint32_t total;		// counter ticks of all tasks since the start of the scheduler
+} runTimeStats_t;
+
+// portCONFIGURE_TIMER_FOR_RUN_TIME_STATS(), starts TCD0
+void vRunTimeStatsInit(void);
+
+// portGET_RUN_TIME_COUNTER_VALUE()
+uint32_t ulRunTimeStatsCounter(void);
+
+// Takes a sample of all tasks. The percentages cover the time since the
+// previous call, the first one since the start of the scheduler.
+const runTimeStats_t *pxRunTimeStatsSample(void);
+
+#endif /* RUNTIMESTATS_H_ */
@@ -0,0 +1,34 @@
+/*
+ * seriesAccel.h
+ *
+ * Created: 16.10.2026
+ *
+ * Acceleration stage for the alternating series engines. The stage returns a
+ * correction that is added to the raw partial sum S_n = a_0 + ... + a_(n-1)
+ * and estimates the missing tail. The terms come from a callback of the
+ * engine, so the hot summation loop stays untouched and the stage works with
+ * every number format: the correction is of the size of the last term, where
+ * float precision is plenty.
+ */
+
+
+#ifndef SERIESACCEL_H_
+#define SERIESACCEL_H_
+
+#include <stdint.h>
+
+// Signed term a_k of an alternating series, in units of pi
+typedef float (*seriesTerm_t)(uint32_t k);
+
+// Aitken delta-squared on the last three partial sums:
+// S_n - a_(n-1)^2 / (a_(n-1) - a_(n-2))
+float accelAitken(seriesTerm_t term, uint32_t n);
+
+// Euler transform by repeated averaging of the last ACCEL_EULER_TERMS + 1
+// partial sums, i.e. of the terms a_(n-ACCEL_EULER_TERMS) .. a_(n-1) that are
+// already summed; no term beyond the partial sum is used, so the estimate
+// after n terms is based on n terms
+#define ACCEL_EULER_TERMS	8
+float accelEuler(seriesTerm_t term, uint32_t n);
+
+#endif /* SERIESACCEL_H_ */
@@ -0,0 +1,32 @@
+/*
+ * telemetry.h
+ *
+ * Created: 16.10.2026
+ *
+ * Line based telemetry output on a USART (TX only, 8N1). Lines are sent
+ * with busy waiting, so it is meant for a few short lines per second from
+ * one task (the controller), not for the engines.
+ */
+
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <avr/pgmspace.h>
+#include "piCalcConfig.h"
+
+#if (PI_TELEMETRY == 1)
+void vTelemetryInit(void);
+
+// Formats one line with printf syntax and sends it followed by CR LF, the
+// format is read from flash
+void vTelemetryPrintf_P(const char *format, ...);
+
+// Takes a literal format, which is kept in flash instead of RAM
+#define vTelemetryPrintf(format, ...)	vTelemetryPrintf_P(PSTR(format), ##__VA_ARGS__)
+#else
+#define vTelemetryInit()
+#define vTelemetryPrintf(...)
+#endif
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,74 @@
+/*
+ * traceRecorder.h
+ *
+ * Created: 16.10.2026
+ *
+ * Scheduler trace: the FreeRTOS trace macros write context switches, queue
+ * traffic, event group bits and task notifications into a ring of 32-bit
+ * events. The ring and its header sit in one block that starts with the
+ * magic "PITR", so a memory dump of a simulator finds it, and the controller
+ * sends it as telemetry lines. host/traceToChrome.c turns either into a
+ * Chrome / Perfetto timeline.
+ *
+ * Event word: type (bits 31-28), object number (27-24), time (23-0) in
+ * ticks of the run-time statistics counter (2 us, wraps after 33.5 s).
+ * The block has no padding on the AVR nor on a little-endian PC.
+ */
+
+
+#ifndef TRACERECORDER_H_
+#define TRACERECORDER_H_
+
+#include <stdint.h>
+
+#define TRACE_MAGIC				"PITR"
+#define TRACE_VERSION			1
+
+// Task names kept for the timeline, by task number 1..TRACE_TASKS
+#define TRACE_TASKS				8
+#define TRACE_NAME_LENGTH		8
+
+// Event types, the object is a task, queue or event group number
+#define TRACE_SWITCHED_IN		0
+#define TRACE_SWITCHED_OUT		1
+#define TRACE_QUEUE_SEND		2
+#define TRACE_QUEUE_RECEIVE		3
+#define TRACE_QUEUE_SEND_ISR	4
+#define TRACE_QUEUE_RECEIVE_ISR	5
+#define TRACE_EVENT_GROUP_SET	6
+#define TRACE_TASK_NOTIFY		7
+#define TRACE_TASK_NOTIFY_ISR	8
+
+#define TRACE_TYPE(event)		((uint8_t)((event) >> 28))
+#define TRACE_OBJECT(event)		((uint8_t)(((event) >> 24) & 0x0F))
+#define TRACE_TIME(event)		((event) & 0x00FFFFFFUL)
+
+// Flags
+#define TRACE_WRAPPED			0x01	// the ring was filled, the oldest event is at next
+
+typedef struct {
+	char magic[4];
+	uint8_t version;
+	uint8_t flags;
+	uint16_t length;		// events in the ring
+	uint16_t next;			// index of the next event written
+	uint16_t ticksPerMs;	// time base of the events
+	char names[TRACE_TASKS][TRACE_NAME_LENGTH];	// not terminated if the name fills it
+	uint32_t ring[];
+} traceBuffer_t;
+
+// Allocates the ring of PI_TRACE_EVENTS from the heap, before the first
+// task, queue or event group is created
+void vTraceInit(void);
+
+// Called by the trace macros, from tasks, the kernel and interrupts
+void vTraceRecord(uint8_t type, uint8_t object);
+void vTraceTaskCreated(uint8_t number, const char *name);
+uint8_t uxTraceQueueNumber(void);
+uint8_t uxTraceEventGroupNumber(void);
+
+// Sends the block as "trace,<offset>,<hex>" telemetry lines. Recording
+// pauses meanwhile, so the dump is consistent.
+void vTraceDump(void);
+
+#endif /* TRACERECORDER_H_ */
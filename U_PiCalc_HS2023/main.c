@@ -10,6 +10,7 @@
 #include "math.h"
 #include "stdio.h"
 #include "string.h"
+#include "stddef.h"
 #include "sleepConfig.h"
 #include "avr_compiler.h"
 #include "pmic_driver.h"
@@ -36,14 +37,22 @@
 #include "errorHandler.h"
 #include "NHD0420Driver.h"
 #include "ButtonHandler.h"
+#include "piCalcConfig.h"
+#include "dfloat.h"
+#include "benchmark.h"
+#include "piEngine.h"
+#include "telemetry.h"
+#include "nvStore.h"
+#include "checkpoint.h"
+#include "runTimeStats.h"
+#include "traceRecorder.h"
 
 // ===============================
 // Function Declarations
 // ===============================
 extern void vApplicationIdleHook(void);
 void vControllerTask(void* pvParameters);
-void vPiCalcLeibnizTask(void* pvParameters);
-void vPiCalcNilkanthaTask(void* pvParameters);
+void vPiEngineWorkerTask(void* pvParameters);
 void vButtonHandler(void* pvParameters);
 
 // ===============================
@@ -53,267 +62,1031 @@ void vButtonHandler(void* pvParameters);
 #define EVBUTTONS_S2    1<<1
 #define EVBUTTONS_S3    1<<2
 #define EVBUTTONS_S4    1<<3
-#define EVBUTTONS_CLEAR 0xFF
+#define EVBUTTONS_L1    1<<4
+#define EVBUTTONS_L2    1<<5
+#define EVBUTTONS_L4    1<<6
+#define EVBUTTONS_L3    1<<7
+#define EVBUTTONS_ALL   0xFF
+
+// Set by the worker when the shown engine published new values
+#define EVENGINE_PUBLISHED 1<<8
+
+// ===============================
+// Engine commands
+// ===============================
+// Every engine has a mailbox of three bits in the notification value of the
+// worker task. A command is a single xTaskNotify() with eSetBits: it reaches
+// exactly the addressed engines, commands to different engines never
+// overwrite each other, and the worker sleeps until one arrives.
+#define PI_COMMAND_START	(1 << 0)
+#define PI_COMMAND_STOP		(1 << 1)
+#define PI_COMMAND_RESET	(1 << 2)
+#define PI_COMMAND_BITS		3
+#define PI_COMMAND_MASK		((1 << PI_COMMAND_BITS) - 1)
+#define PI_COMMAND_MAIL(index, command)	((uint32_t)(command) << ((index) * PI_COMMAND_BITS))
+
+// Engine parameters: a long press puts its button into the parameter word
+// of the selected engine and sets this bit. The worker calls longPress()
+// between two batches, so engine state is only ever written by the worker.
+#define PI_COMMAND_PARAMETER	(1UL << 30)
+#define PI_PARAMETER_BUTTON(button)	(1 << (button))
+
+// No mailbox, only wakes the worker after the selected engine changed
+#define PI_COMMAND_SELECT	(1UL << 31)
 
 // ===============================
-// Enumerations
+// Engine registry
 // ===============================
-typedef enum {
-    LEIBNIZ,
-    NILKANTHA
-} AlgorithmMode;
+// All engines run in the worker task, S4 steps through them in this order.
+// A new engine only needs its descriptor added here.
+const piEngine_t* const piEngines[] = {
+	&piEngineLeibniz,
+	&piEngineNilkantha,
+	&piEngineSpigot,
+	&piEngineMachin,
+	&piEngineBbp,
+	&piEngineAgm,
+	&piEngineRamanujan,
+	&piEngineInterval,
+	&piEngineMonteCarlo,
+};
+#define PI_ENGINE_COUNT (sizeof(piEngines) / sizeof(piEngines[0]))
+
+// The mailboxes of all engines must fit below PI_COMMAND_PARAMETER
+typedef char piCommandMailboxesFit[(PI_ENGINE_COUNT * PI_COMMAND_BITS <= 30) ? 1 : -1];
+
+// S4 position after the last engine: all racers run side by side
+#define PI_ENGINE_RACE PI_ENGINE_COUNT
 
-// Current algorithm mode (default is Leibniz)
-AlgorithmMode currentAlgorithm = LEIBNIZ;
+// Current engine (default is Leibniz) or PI_ENGINE_RACE
+volatile uint8_t currentEngine = 0;
 
 // ===============================
 // Global Variables
 // ===============================
-// Shared variables to hold the approximation of Pi (for display or analysis)
-volatile float pi_approximation_leibniz = 0.0;
-volatile float pi_approximation_nilkantha = 3.0;  // Nilkantha starts at 3
-
-// Variables for PI accuracy tracking
-volatile BaseType_t piAccuracyAchievedLeibniz = pdFALSE;
-volatile BaseType_t piAccuracyAchievedNilkantha = pdFALSE;
-
-// Time tracking variables
-TickType_t startTimeLeibniz = 0, elapsedTimeLeibniz = 0;
-TickType_t startTimeNilkantha = 0, elapsedTimeNilkantha = 0;
-
-// Task handling for suspend
-TaskHandle_t xLeibnizTaskHandle = NULL;
-TaskHandle_t xNilkanthaTaskHandle = NULL;
-
-// Running flag for formula
-bool isLeibnizRunning = false;
-bool isNilkanthaRunning = false;
-
-// Semaphores and Event Groups
-SemaphoreHandle_t xResetSemaphore = NULL;
-SemaphoreHandle_t xStartSemaphore = NULL;
-SemaphoreHandle_t xStopSemaphore = NULL;
+// Running flag, timing and step count of every engine
+piEngineStatus_t piEngineStatus[PI_ENGINE_COUNT];
+
+// Event Groups and the worker task, which receives the engine commands
 EventGroupHandle_t evButtonEvents;  // Handle for button event group
+TaskHandle_t xPiEngineWorker = NULL;
+
+// Tick at which the controller sent the last command
+volatile TickType_t commandSentTime;
+
+// Long presses not yet applied, per engine, as PI_PARAMETER_BUTTON() bits
+volatile uint8_t piEngineParameter[PI_ENGINE_COUNT];
+
+// Reason of the last reset, decides whether the checkpoints are resumed
+resetReason_t resetReason;
 
 // ===============================
 // Function Definitions
 // ===============================
 
-// Idle task hook for FreeRTOS
+#if (PI_IDLE_COMPUTE == 0)
+// Idle task hook for FreeRTOS, the idle compute mode runs the engines in it
 void vApplicationIdleHook(void) {
     // Currently empty
 }
+#endif
 
 // Main function
 int main(void) {
+    resetReason = getResetReason();
+#if (PI_TRACE == 1)
+	vTraceInit();	// before the first task, queue or event group
+#endif
     vInitClock();   // Initialize system clock
     vInitDisplay(); // Initialize display
+	vTelemetryInit();
 
-    // Create event group for button events and semaphores
+    // Create event group for button events
     evButtonEvents = xEventGroupCreate();
-    xResetSemaphore = xSemaphoreCreateBinary();
-    xStartSemaphore = xSemaphoreCreateBinary();
-    xStopSemaphore = xSemaphoreCreateBinary();
 
     // Create FreeRTOS tasks with optimized stack size and priority
     xTaskCreate(vButtonHandler, "btTask", configMINIMAL_STACK_SIZE + 50, NULL, 4, NULL);  
     xTaskCreate(vControllerTask, "control_tsk", configMINIMAL_STACK_SIZE + 100, NULL, 3, NULL); 
-	xTaskCreate(vPiCalcLeibnizTask, "pi_calc_leibniz", configMINIMAL_STACK_SIZE + 200, NULL, 2, &xLeibnizTaskHandle);
-	xTaskCreate(vPiCalcNilkanthaTask, "pi_calc_nilkantha", configMINIMAL_STACK_SIZE + 200, NULL, 2, &xNilkanthaTaskHandle);
+#if (PI_IDLE_COMPUTE == 0)
+	xTaskCreate(vPiEngineWorkerTask, "pi_wrk", PI_WORKER_STACK_SIZE, NULL, 2, &xPiEngineWorker);
+#endif
+
+	// Engine buffers are allocated before the scheduler starts, the spigot
+	// takes the rest of the heap once the worker task runs
+	for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++) {
+		if (piEngines[i]->setup != NULL) {
+			piEngines[i]->setup(piEngines[i]->state);
+		}
+	}
+	// The heap budget (FreeRTOSConfig.h) must leave at least the spigot's reserve
+	if (xPortGetFreeHeapSize() < PI_SPIGOT_HEAP_RESERVE) {
+		error(ERR_LOW_HEAP_SPACE);
+	}
 
     // Start the FreeRTOS scheduler
     vTaskStartScheduler();
     return 0;
 }
 
-// Task for calculating pi using the Leibniz formula
-void vPiCalcLeibnizTask(void* pvParameters)
+// Engines that take part in a race: all that approximate pi as a whole
+static bool isRacer(uint8_t index)
 {
-	uint32_t iterations = 0;
-	float sign = 1.0;
+	return piEngines[index]->estimatesPi;
+}
 
-	for (;;)
+// Clears the run results of an engine that starts over, in a critical
+// section of the caller
+static void vPiEngineClear(piEngineStatus_t* status)
+{
+	status->clockStopped = false;
+	status->finished = false;
+	status->steps = 0;
+	status->decimals = 0;
+	status->decades = 0;
+}
+
+// Records run time and step count of every decade the error newly fell
+// below. The entries lie past the published count decades, the controller
+// reads them once the caller publishes the returned count.
+static uint8_t xPiEngineMilestones(piEngineStatus_t* status, uint8_t decades, uint16_t decimals, uint32_t steps)
+{
+	TickType_t time = xTaskGetTickCount() - status->startTime;
+
+	while (decades < decimals && decades < PI_MILESTONE_DECADES)
 	{
-		// Check if we should start the calculation
-		if (xSemaphoreTake(xStartSemaphore, 0) == pdTRUE)
+		status->milestones[decades].time = time;
+		status->milestones[decades].steps = steps;
+		decades++;
+	}
+	return decades;
+}
+
+static void vPiEngineStart(uint8_t index)
+{
+	const piEngine_t* engine = piEngines[index];
+	piEngineStatus_t* status = &piEngineStatus[index];
+	bool restart = (engine->start != NULL && engine->start(engine->state));
+
+	taskENTER_CRITICAL();
+	if (restart)
+	{
+		vPiEngineClear(status);
+	}
+	status->running = true;
+	status->startTime = xTaskGetTickCount();
+	taskEXIT_CRITICAL();
+}
+
+static void vPiEngineStop(uint8_t index)
+{
+	piEngineStatus_t* status = &piEngineStatus[index];
+
+	taskENTER_CRITICAL();
+	if (status->running && !status->clockStopped) {
+		status->elapsedTime = xTaskGetTickCount() - status->startTime;
+	}
+	status->running = false;
+	taskEXIT_CRITICAL();
+}
+
+static void vPiEngineReset(uint8_t index)
+{
+	const piEngine_t* engine = piEngines[index];
+	piEngineStatus_t* status = &piEngineStatus[index];
+
+	engine->init(engine->state);
+	taskENTER_CRITICAL();
+	vPiEngineClear(status);
+	status->running = false;
+	status->elapsedTime = 0;
+	status->startTime = xTaskGetTickCount();
+	taskEXIT_CRITICAL();
+}
+
+// Runs one batch of an engine for the given ticks, returns false if it has
+// nothing to do. The steps of a batch run in place of a rest also count as
+// rest steps.
+static bool xPiEngineRunBatch(uint8_t index, TickType_t ticks, bool rest)
+{
+	const piEngine_t* engine = piEngines[index];
+	piEngineStatus_t* status = &piEngineStatus[index];
+
+	if (!status->running || status->finished) {
+		return false;
+	}
+
+	// Run as many steps as fit into one batch slice, commands are only
+	// checked again between two batches. The results collect in locals and
+	// are published at the end in one critical section, like the engines'
+	// batch(), so the controller never reads a half written 32-bit value.
+	uint32_t steps = 0;
+	uint16_t decimals = status->decimals;
+	uint8_t decades = status->decades;
+	bool clockStopped = status->clockStopped;
+	bool finished = false;
+	TickType_t elapsedTime = status->elapsedTime;
+	TickType_t batchStart = xTaskGetTickCount();
+	do
+	{
+		uint16_t result = engine->step(engine->state);
+		steps++;
+
+		uint16_t stepDecimals = result & PI_STEP_DECIMALS;
+		if (stepDecimals > decimals)
 		{
-			isLeibnizRunning = true;  // Set the flag
-			startTimeLeibniz = xTaskGetTickCount(); // Capture start time
+			decades = xPiEngineMilestones(status, decades, stepDecimals, status->steps + steps);
+			decimals = stepDecimals;
 		}
-
-		// Check if we should stop the calculation
-		if (xSemaphoreTake(xStopSemaphore, 0) == pdTRUE)
+		// The elapsed time stops at the accuracy target or at the end of the run
+		bool accurate = engine->clockToAccuracy && (decimals >= PI_ACCURACY_DIGITS);
+		if ((accurate || (result & PI_STEP_FINISHED)) && !clockStopped)
 		{
-			isLeibnizRunning = false;  // Clear the flag
+			clockStopped = true;
+			elapsedTime = xTaskGetTickCount() - status->startTime;
 		}
-
-		// Check if we should reset
-		if (xSemaphoreTake(xResetSemaphore, 0) == pdTRUE)
+		if (result & PI_STEP_FINISHED)
 		{
-			pi_approximation_leibniz = 0.0;
-			iterations = 0;
-			sign = 1.0;
-			isLeibnizRunning = false;  // Clear the flag
-			piAccuracyAchievedLeibniz = pdFALSE;
+			finished = true;
+			break;
+		}
+	} while ((xTaskGetTickCount() - batchStart) < ticks);
+	if (!clockStopped) {
+		elapsedTime = xTaskGetTickCount() - status->startTime;
+	}
+
+	taskENTER_CRITICAL();
+	status->steps += steps;
+	status->decimals = decimals;
+	status->decades = decades;
+	status->clockStopped = clockStopped;
+	status->elapsedTime = elapsedTime;
+	status->finished = finished;
+	if (rest) {
+		status->restSteps += steps;
+	}
+	taskEXIT_CRITICAL();
+
+	if (engine->batch != NULL) {
+		engine->batch(engine->state);
+	}
+	// Wake the controller if the display shows this engine
+	if (currentEngine == index || currentEngine == PI_ENGINE_RACE) {
+		xEventGroupSetBits(evButtonEvents, EVENGINE_PUBLISHED);
+	}
+	return true;
+}
+
+#if (PI_CHECKPOINT == 1)
+// Ring in the EEPROM of every engine with a checkpointSize (slots 0 = none)
+// and the step count and running flag of its last record
+static checkpointRing_t checkpointRings[PI_ENGINE_COUNT];
+static uint32_t checkpointSteps[PI_ENGINE_COUNT];
+static bool checkpointRunning[PI_ENGINE_COUNT];
+
+#define PI_CHECKPOINT_STATUS_BYTES offsetof(piEngineStatus_t, startTime)
+
+// Gives every engine with a checkpoint its ring and restores the newest
+// record. A software reset (error()) resumes the run, after a power cycle or
+// the reset button it waits for Start. A debugger reset starts fresh, the
+// old records are overwritten by the next saves.
+static void vCheckpointRestore(void)
+{
+	uint16_t base = 0;
+
+	for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++)
+	{
+		const piEngine_t* engine = piEngines[i];
+		piEngineStatus_t* status = &piEngineStatus[i];
+		uint16_t ringBytes = PI_CHECKPOINT_SLOTS * PI_CHECKPOINT_SLOT_BYTES;
+
+		if (engine->checkpointSize == 0 || base + ringBytes > nvStoreEeprom.size ||
+			PI_CHECKPOINT_STATUS_BYTES + engine->checkpointSize > PI_CHECKPOINT_SLOT_BYTES - CHECKPOINT_OVERHEAD) {
+			continue;
 		}
+		checkpointRingInit(&checkpointRings[i], &nvStoreEeprom, base, PI_CHECKPOINT_SLOTS, PI_CHECKPOINT_SLOT_BYTES,
+			(PI_CHECKPOINT_VERSION << 4) | i);
+		base += ringBytes;
 
-		if (isLeibnizRunning)
+		// The controller already runs, it sees the record only as a whole
+		taskENTER_CRITICAL();
+		if (resetReason != RESETREASON_DEBUGGERRESET &&
+			checkpointLoad(&checkpointRings[i], status, PI_CHECKPOINT_STATUS_BYTES, engine->state, engine->checkpointSize))
 		{
-			// Leibniz formula for pi approximation
-			pi_approximation_leibniz += (sign / (2 * iterations + 1)) * 4;
-			
-			// Check for accuracy
-			if (!piAccuracyAchievedLeibniz && fabs(pi_approximation_leibniz - M_PI) < 0.00001)
-			{
-				piAccuracyAchievedLeibniz = pdTRUE;
-				//isLeibnizRunning = false;  // Optionally, stop the calculation after accuracy is achieved
-			}
+			status->running = status->running && (resetReason == RESETREASON_SOFTWARERESET);
+			status->startTime = xTaskGetTickCount() - status->elapsedTime;
+			status->rate = 0;
+		}
+		taskEXIT_CRITICAL();
+		checkpointSteps[i] = status->steps;
+		checkpointRunning[i] = status->running;
+	}
+}
+
+// Saves every engine whose steps or running flag changed since its last
+// record, between two batches so the state is consistent
+static void vCheckpointSave(void)
+{
+	for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++)
+	{
+		const piEngine_t* engine = piEngines[i];
+		piEngineStatus_t* status = &piEngineStatus[i];
 
-			sign = -sign;
-			iterations++;
+		if (checkpointRings[i].slots == 0 ||
+			(status->steps == checkpointSteps[i] && status->running == checkpointRunning[i])) {
+			continue;
 		}
+		if (status->running && !status->clockStopped) {
+			taskENTER_CRITICAL();
+			status->elapsedTime = xTaskGetTickCount() - status->startTime;
+			taskEXIT_CRITICAL();
+		}
+		checkpointSave(&checkpointRings[i], status, PI_CHECKPOINT_STATUS_BYTES, engine->state, engine->checkpointSize);
+		checkpointSteps[i] = status->steps;
+		checkpointRunning[i] = status->running;
+	}
+}
+#endif
 
-		vTaskDelay(pdMS_TO_TICKS(10)); // Optional delay to prevent CPU hogging
+// Applies the commands of an engine's mailbox in the order Start, Stop, Reset
+static void vPiEngineCommand(uint8_t index, uint8_t command, TickType_t sent)
+{
+	piEngineStatus_t* status = &piEngineStatus[index];
+
+	if (command & PI_COMMAND_START) {
+		vPiEngineStart(index);
+	}
+	if (command & PI_COMMAND_STOP) {
+		vPiEngineStop(index);
 	}
+	if (command & PI_COMMAND_RESET) {
+		vPiEngineReset(index);
+	}
+	taskENTER_CRITICAL();
+	status->commandLatency = xTaskGetTickCount() - sent;
+	status->command = command;
+	status->commands++;
+	taskEXIT_CRITICAL();
 }
 
-// Task for calculating pi using the Nilkantha formula
-void vPiCalcNilkanthaTask(void* pvParameters)
+// Applies the long presses waiting in the parameter words, in button order
+static void vPiEngineParameters(void)
 {
-	uint32_t iterations = 0;
-	float sign = 1.0;
+	for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++)
+	{
+		taskENTER_CRITICAL();
+		uint8_t buttons = piEngineParameter[i];
+		piEngineParameter[i] = 0;
+		taskEXIT_CRITICAL();
+		for (uint8_t button = BUTTON1; button <= BUTTON2; button++) {
+			if ((buttons & PI_PARAMETER_BUTTON(button)) && piEngines[i]->longPress != NULL) {
+				piEngines[i]->longPress(piEngines[i]->state, button);
+			}
+		}
+	}
+}
 
-	for (;;)
+// Worker state, kept by the worker task or by the idle hook
+static uint8_t raceIndex = 0;
+#if (PI_CHECKPOINT == 1)
+static TickType_t lastCheckpoint;
+#endif
+
+static void vPiEngineWorkerInit(void)
+{
+	for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++) {
+		piEngines[i]->init(piEngines[i]->state);
+	}
+#if (PI_CHECKPOINT == 1)
+	vCheckpointRestore();
+	lastCheckpoint = xTaskGetTickCount();
+#endif
+}
+
+// One round of the worker: applies the commands of the mail, then runs one
+// batch of ticks of the selected engine or of the next racer. Returns false
+// if no engine has anything to do.
+static bool xPiEngineWorkerRound(uint32_t mail, TickType_t ticks, bool rest)
+{
+	uint8_t selected = currentEngine;
+	bool race = (selected == PI_ENGINE_RACE);
+
+	// The controller addressed the engines when it sent the commands
+	bool commands = false;
+	if ((mail & ~PI_COMMAND_SELECT) != 0)
 	{
-		// Check if we should start the calculation
-		if (xSemaphoreTake(xStartSemaphore, 0) == pdTRUE)
+		taskENTER_CRITICAL();
+		TickType_t sent = commandSentTime;
+		taskEXIT_CRITICAL();
+		// Parameters first, so a Start right after a long press uses them
+		if (mail & PI_COMMAND_PARAMETER) {
+			vPiEngineParameters();
+		}
+		for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++)
 		{
-			isNilkanthaRunning = true; // Set the flag
-			startTimeNilkantha = xTaskGetTickCount(); // Capture start time
+			uint8_t command = (mail >> (i * PI_COMMAND_BITS)) & PI_COMMAND_MASK;
+			if (command != 0) {
+				vPiEngineCommand(i, command, sent);
+			}
 		}
+		commands = true;
+		xEventGroupSetBits(evButtonEvents, EVENGINE_PUBLISHED);
+	}
 
-		// Check if we should stop the calculation
-		if (xSemaphoreTake(xStopSemaphore, 0) == pdTRUE)
+	bool busy = false;
+	if (race)
+	{
+		// One batch of the next racer with work left, so every racer gets
+		// the same share of the CPU
+		for (uint8_t n = 0; n < PI_ENGINE_COUNT && !busy; n++)
 		{
-			isNilkanthaRunning = false; // Set the flag
+			raceIndex = (raceIndex + 1) % PI_ENGINE_COUNT;
+			busy = isRacer(raceIndex) && xPiEngineRunBatch(raceIndex, ticks, rest);
 		}
+	}
+	else
+	{
+		busy = xPiEngineRunBatch(selected, ticks, rest);
+	}
 
-		// Check if we should reset
-		if (xSemaphoreTake(xResetSemaphore, 0) == pdTRUE)
-		{
-			pi_approximation_nilkantha = 3.0;
-			iterations = 0;
-			sign = 1.0;
-			isNilkanthaRunning = false; // Set the flag
-			piAccuracyAchievedNilkantha = pdFALSE;
+#if (PI_CHECKPOINT == 1)
+	// Commands are saved at once, a run once per period
+	if (commands || (xTaskGetTickCount() - lastCheckpoint) >= pdMS_TO_TICKS(PI_CHECKPOINT_MS))
+	{
+		vCheckpointSave();
+		lastCheckpoint = xTaskGetTickCount();
+	}
+#endif
+	return busy;
+}
+
+#if (PI_IDLE_COMPUTE == 0)
+// Task running the selected engine in batches, or all racers round-robin.
+// It sleeps on its notification until a command arrives, and while an
+// engine runs the rest between two batches ends early for a command.
+void vPiEngineWorkerTask(void* pvParameters)
+{
+	// A restored checkpoint may already run, so look before the first sleep
+	TickType_t wait = 0;
+
+	vPiEngineWorkerInit();
+	for (;;)
+	{
+		uint32_t mail = 0;
+		xTaskNotifyWait(0, UINT32_MAX, &mail, wait);
+		bool busy = xPiEngineWorkerRound(mail, PI_BATCH_TICKS, false);
+
+		// Let the lower priority tasks (idle) run between two batches, with
+		// nothing to run sleep until the next command
+		wait = busy ? PI_BATCH_REST_TICKS : portMAX_DELAY;
+	}
+}
+#else
+// The idle task is the worker: it runs the engines whenever no other task
+// is ready, so it must never block. Each call is one batch and, in place of
+// the rest the worker task would sleep, a second one whose steps are counted
+// as the gain of this mode.
+void vApplicationIdleHook(void)
+{
+	static bool initialised = false;
+	uint32_t mail = 0;
+
+	if (!initialised) {
+		vPiEngineWorkerInit();
+		initialised = true;
+	}
+	xTaskNotifyWait(0, UINT32_MAX, &mail, 0);
+	if (xPiEngineWorkerRound(mail, PI_BATCH_TICKS, false)) {
+		xPiEngineWorkerRound(0, PI_BATCH_REST_TICKS, true);
+	}
+}
+
+// The idle task takes the worker's stack, static so that its size is free
+// to choose; the timer task then needs static memory as well
+static StaticTask_t idleTaskBuffer;
+static StackType_t idleTaskStack[PI_WORKER_STACK_SIZE];
+static StaticTask_t timerTaskBuffer;
+static StackType_t timerTaskStack[configTIMER_TASK_STACK_DEPTH];
+
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize)
+{
+	*ppxIdleTaskTCBBuffer = &idleTaskBuffer;
+	*ppxIdleTaskStackBuffer = idleTaskStack;
+	*pulIdleTaskStackSize = PI_WORKER_STACK_SIZE;
+}
+
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint32_t *pulTimerTaskStackSize)
+{
+	*ppxTimerTaskTCBBuffer = &timerTaskBuffer;
+	*ppxTimerTaskStackBuffer = timerTaskStack;
+	*pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
+
+// The worker publishes the status in critical sections (xPiEngineRunBatch),
+// the controller reads the multi-byte values the same way
+
+// Step count of an engine
+static uint32_t xPiEngineSteps(uint8_t index)
+{
+	taskENTER_CRITICAL();
+	uint32_t steps = piEngineStatus[index].steps;
+	taskEXIT_CRITICAL();
+	return steps;
+}
+
+// Milestone of a decade below the published count
+static piMilestone_t xMilestone(const piEngineStatus_t* status, uint8_t decade)
+{
+	taskENTER_CRITICAL();
+	piMilestone_t milestone = status->milestones[decade];
+	taskEXIT_CRITICAL();
+	return milestone;
+}
+
+// True once the engine's error fell below PI_ACCURACY_TARGET
+static bool isAccurate(const piEngineStatus_t* status)
+{
+	return status->decades >= PI_ACCURACY_DIGITS;
+}
+
+// Run time until the error fell below PI_ACCURACY_TARGET
+static TickType_t xAccurateTime(const piEngineStatus_t* status)
+{
+	return xMilestone(status, PI_ACCURACY_DIGITS - 1).time;
+}
+
+// Race leaderboard, ranks 1-3 or 4-6 of the racers by correct decimals or by
+// the time to PI_ACCURACY_TARGET
+static void vRaceFormat(uint8_t page, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	uint8_t order[PI_ENGINE_COUNT];
+	uint16_t digits[PI_ENGINE_COUNT];
+	uint8_t racers = 0;
+	bool byTime = (page & 1) != 0;
+
+	for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++) {
+		if (isRacer(i)) {
+			taskENTER_CRITICAL();
+			digits[i] = piEngineStatus[i].decimals;
+			taskEXIT_CRITICAL();
+			order[racers++] = i;
 		}
+	}
 
-		if (isNilkanthaRunning)
+	// Insertion sort: most decimals first, resp. the earliest to reach the
+	// target. Statistical engines follow the ones with verified digits.
+	for (uint8_t i = 1; i < racers; i++)
+	{
+		uint8_t index = order[i];
+		uint8_t j = i;
+		while (j > 0)
 		{
-			// Nilkantha formula for pi approximation
-			pi_approximation_nilkantha += sign * (4.0 / ((2 * iterations + 2) * (2 * iterations + 3) * (2 * iterations + 4)));
-			
-			// Check for accuracy
-			if (!piAccuracyAchievedNilkantha && fabs(pi_approximation_nilkantha - M_PI) < 0.00001)
-			{
-				piAccuracyAchievedNilkantha = pdTRUE;
-				elapsedTimeNilkantha = xTaskGetTickCount() - startTimeNilkantha;
-				//isRunning = false; // Optionally, stop the calculation after accuracy is achieved
+			uint8_t other = order[j - 1];
+			bool ahead;
+			if (piEngines[index]->statistical != piEngines[other]->statistical) {
+				ahead = piEngines[other]->statistical;
+			} else if (byTime) {
+				ahead = isAccurate(&piEngineStatus[index]) && (!isAccurate(&piEngineStatus[other]) ||
+					xAccurateTime(&piEngineStatus[index]) < xAccurateTime(&piEngineStatus[other]));
+			} else {
+				ahead = digits[index] > digits[other];
+			}
+			if (!ahead) {
+				break;
 			}
+			order[j] = other;
+			j--;
+		}
+		order[j] = index;
+	}
 
-			sign = -sign;
-			iterations++;
+	uint8_t first = (page >> 1) * PI_ENGINE_LINES;
+	for (uint8_t line = 0; line < PI_ENGINE_LINES && first + line < racers; line++)
+	{
+		uint8_t rank = first + line;
+		uint8_t index = order[rank];
+		// A statistical engine gets no place and its decimals read "ci"
+		bool ranked = !piEngines[index]->statistical;
+		char place = ranked ? '1' + rank : '-';
+		if (!byTime) {
+			snprintf_P(lines[line], PI_ENGINE_LINE_SIZE, PSTR("E%c %-10s%5u%s"), place, piEngines[index]->name, digits[index],
+				ranked ? "dg" : "ci");
+		} else if (isAccurate(&piEngineStatus[index])) {
+			snprintf_P(lines[line], PI_ENGINE_LINE_SIZE, PSTR("T%c %-9s%6lums"), place, piEngines[index]->name, xAccurateTime(&piEngineStatus[index]));
+		} else {
+			snprintf_P(lines[line], PI_ENGINE_LINE_SIZE, PSTR("T%c %-9s%8s"), place, piEngines[index]->name, "--");
 		}
+	}
+}
 
-		vTaskDelay(pdMS_TO_TICKS(10)); // Optional delay to prevent CPU hogging
+// Milestone page of an engine: two decades per page, with run time and steps
+static uint8_t xMilestonePages(uint8_t index)
+{
+	uint8_t decades = piEngineStatus[index].decades;
+	return (decades > 2) ? (decades + 1) / 2 : 1;
+}
+
+static void vMilestoneFormat(uint8_t index, uint8_t page, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	const piEngineStatus_t* status = &piEngineStatus[index];
+
+	snprintf_P(lines[0], PI_ENGINE_LINE_SIZE, PSTR("%s milestones"), piEngines[index]->name);
+	if (status->decades == 0) {
+		strcpy_P(lines[1], PSTR("no decade yet"));
+		return;
+	}
+	for (uint8_t line = 1; line < PI_ENGINE_LINES; line++)
+	{
+		uint8_t decade = 2 * page + line - 1;
+		if (decade < status->decades) {
+			piMilestone_t milestone = xMilestone(status, decade);
+			snprintf_P(lines[line], PI_ENGINE_LINE_SIZE, PSTR("e-%-2u%6lums%8lu"), decade + 1,
+				milestone.time, milestone.steps);
+		}
+	}
+}
+
+// Decade the ETA is given for: the accuracy target, once reached the next one
+static uint16_t xEtaDecade(uint16_t decimals)
+{
+	return (decimals < PI_ACCURACY_DIGITS) ? PI_ACCURACY_DIGITS : decimals + 1;
+}
+
+// Run time predicted for a decade when the previous one was reached: the
+// closed-form steps at the average step rate of the run so far, 0 = none
+static TickType_t xPredictedTime(uint8_t index, uint8_t decade)
+{
+	const piEngine_t* engine = piEngines[index];
+
+	if (engine->stepsFor == NULL || decade < 2) {
+		return 0;
+	}
+	piMilestone_t previous = xMilestone(&piEngineStatus[index], decade - 2);
+	if (previous.steps == 0) {
+		return 0;
+	}
+	return (TickType_t)((float)previous.time * engine->stepsFor(engine->state, decade) / previous.steps);
+}
+
+// ETA page of an engine with a closed-form error: steps left to the next
+// decade and the time they take at the last measured step rate
+static void vEtaFormat(uint8_t index, uint32_t rate, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	const piEngine_t* engine = piEngines[index];
+	const piEngineStatus_t* status = &piEngineStatus[index];
+
+	taskENTER_CRITICAL();
+	uint16_t decimals = status->decimals;
+	uint32_t done = status->steps;
+	taskEXIT_CRITICAL();
+	uint16_t decade = xEtaDecade(decimals);
+	uint32_t steps = engine->stepsFor(engine->state, decade);
+
+	snprintf_P(lines[0], PI_ENGINE_LINE_SIZE, PSTR("%s ETA e-%u"), engine->name, decade);
+	if (steps == 0) {
+		strcpy_P(lines[1], PSTR("out of reach"));
+		return;
+	}
+	uint32_t left = (steps > done) ? steps - done : 0;
+	snprintf_P(lines[1], PI_ENGINE_LINE_SIZE, PSTR("left %11lu st"), left);
+	if (rate == 0) {
+		strcpy_P(lines[2], PSTR("no rate, run first"));
+	} else {
+		snprintf_P(lines[2], PI_ENGINE_LINE_SIZE, PSTR("in %14.1fs"), (float)left / rate);
+	}
+}
+
+#if (PI_RUNTIME_STATS == 1)
+// Tasks of the CPU page, two per line
+#define CPU_PAGE_TASKS (2 * PI_ENGINE_LINES)
+
+static uint8_t xCpuPages(const runTimeStats_t* stats)
+{
+	return (stats->count > CPU_PAGE_TASKS) ? (stats->count + CPU_PAGE_TASKS - 1) / CPU_PAGE_TASKS : 1;
+}
+
+// CPU page: share in percent of every task since the previous redraw, e.g.
+// "pi_wrk  81  IDLE     9"; task names are cut to six characters
+static void vCpuFormat(const runTimeStats_t* stats, uint8_t page, char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE])
+{
+	for (uint8_t line = 0; line < PI_ENGINE_LINES; line++)
+	{
+		uint8_t first = page * CPU_PAGE_TASKS + 2 * line;
+		if (first + 1 < stats->count) {
+			snprintf_P(lines[line], PI_ENGINE_LINE_SIZE, PSTR("%-6.6s%3u  %-6.6s%3u"), stats->tasks[first].name,
+				stats->tasks[first].percent, stats->tasks[first + 1].name, stats->tasks[first + 1].percent);
+		} else if (first < stats->count) {
+			snprintf_P(lines[line], PI_ENGINE_LINE_SIZE, PSTR("%-6.6s%3u"), stats->tasks[first].name, stats->tasks[first].percent);
+		}
 	}
 }
 
-// Task for handling display based on button presses
+// Run time and share of every task since the start of the scheduler
+static void vCpuDump(const runTimeStats_t* stats)
+{
+	for (uint8_t i = 0; i < stats->count; i++) {
+		const runTimeTask_t* task = &stats->tasks[i];
+		vTelemetryPrintf("cpu,%s,%lu,%u", task->name, task->time / RUNTIME_STATS_TICKS_PER_MS,
+			(stats->total > 0) ? (uint8_t)(100.0f * task->time / stats->total + 0.5f) : 0);
+	}
+}
+#endif
+
+// Sends a command to the mailbox of the selected engine, in a race to those
+// of all racers, with a single notification of the worker
+static void vPiEngineSend(uint8_t command)
+{
+	uint32_t mail = 0;
+
+	for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++) {
+		if ((currentEngine == PI_ENGINE_RACE) ? isRacer(i) : (i == currentEngine)) {
+			mail |= PI_COMMAND_MAIL(i, command);
+		}
+	}
+	commandSentTime = xTaskGetTickCount();
+	xTaskNotify(xPiEngineWorker, mail, eSetBits);
+}
+
+// Sends a long press to the parameter word of the selected engine
+static void vPiEngineSendParameter(uint8_t button)
+{
+	const piEngine_t* engine = (currentEngine == PI_ENGINE_RACE) ? NULL : piEngines[currentEngine];
+
+	if (engine == NULL || engine->longPress == NULL) {
+		return;
+	}
+	taskENTER_CRITICAL();
+	piEngineParameter[currentEngine] |= PI_PARAMETER_BUTTON(button);
+	taskEXIT_CRITICAL();
+	xTaskNotify(xPiEngineWorker, PI_COMMAND_PARAMETER, eSetBits);
+}
+
+// Task handling the buttons at once and redrawing the display when the shown
+// values changed or the period of a running clock ended
 void vControllerTask(void* pvParameters)
 {
+	// Steps per second, measured over one display period
+	TickType_t lastRateTick = xTaskGetTickCount();
+	TickType_t nextPeriod = lastRateTick + pdMS_TO_TICKS(PI_DISPLAY_PERIOD_MS);
+	TickType_t lastRender = lastRateTick - pdMS_TO_TICKS(PI_DISPLAY_MIN_MS);
+	// A redraw is due, and the screen shows something that changes with time
+	bool redraw = true, periodic = true;
+	uint32_t lastSteps[PI_ENGINE_COUNT] = { 0 };
+#if (PI_IDLE_COMPUTE == 1)
+	// Steps of the idle hook that ran in place of the worker's rests
+	uint32_t lastRestSteps[PI_ENGINE_COUNT] = { 0 };
+#endif
+	// Last step rate while running, the ETA of a stopped engine uses it
+	uint32_t etaRate[PI_ENGINE_COUNT] = { 0 };
+	char lines[PI_ENGINE_LINES][PI_ENGINE_LINE_SIZE];
+	// Page of the leaderboard or milestone view and display periods shown so far
+	uint8_t page = 0, pagePeriods = 0;
+	bool showMilestones = false, showCpu = false;
+	// Milestones and command latencies already sent as telemetry, per engine
+	uint8_t milestonesSent[PI_ENGINE_COUNT] = { 0 };
+	uint8_t commandsSent[PI_ENGINE_COUNT] = { 0 };
+
+#if (PI_IDLE_COMPUTE == 1)
+	// The scheduler has created the idle task, which takes the commands from
+	// the first button on
+	xPiEngineWorker = xTaskGetIdleTaskHandle();
+#endif
+
+#if (PI_BENCHMARK_AT_STARTUP == 1)
+	// Float vs. double-float throughput in CPU cycles per operation
+	dfloatBenchmark_t benchmark;
+	char benchmarkString[21];
+	vBenchmarkDoubleFloat(&benchmark);
+	vDisplayClear();
+	vDisplayWriteStringAtPos(0, 0, "cyc/op   FLT   DFLT");
+	sprintf_P(benchmarkString, PSTR("add   %5u  %5u"), benchmark.floatAdd, benchmark.dfloatAdd);
+	vDisplayWriteStringAtPos(1, 0, "%s", benchmarkString);
+	sprintf_P(benchmarkString, PSTR("mul   %5u  %5u"), benchmark.floatMul, benchmark.dfloatMul);
+	vDisplayWriteStringAtPos(2, 0, "%s", benchmarkString);
+	sprintf_P(benchmarkString, PSTR("div   %5u  %5u"), benchmark.floatDiv, benchmark.dfloatDiv);
+	vDisplayWriteStringAtPos(3, 0, "%s", benchmarkString);
+	vTaskDelay(pdMS_TO_TICKS(5000));
+
+	// Multi-word kernels, C reference vs. the kernel in use, also sent as
+	// telemetry so a simulator run can log them
+	multiwordBenchmark_t kernels;
+	vBenchmarkMultiword(&kernels);
+	vDisplayClear();
+	sprintf_P(benchmarkString, PSTR("div/w  C%5u k%5u"), kernels.divSmallRef, kernels.divSmall);
+	vDisplayWriteStringAtPos(0, 0, "%s", benchmarkString);
+	sprintf_P(benchmarkString, PSTR("mul/w  C%5u k%5u"), kernels.mulSmallRef, kernels.mulSmall);
+	vDisplayWriteStringAtPos(1, 0, "%s", benchmarkString);
+	sprintf_P(benchmarkString, PSTR("mulmod C%5u k%5u"), kernels.mulModRef, kernels.mulMod);
+	vDisplayWriteStringAtPos(2, 0, "%s", benchmarkString);
+	sprintf_P(benchmarkString, PSTR("spig/t C%5u k%5u"), kernels.spigotRef, kernels.spigot);
+	vDisplayWriteStringAtPos(3, 0, "%s", benchmarkString);
+	vTelemetryPrintf("benchmark,mwDivSmall,%u,%u", kernels.divSmallRef, kernels.divSmall);
+	vTelemetryPrintf("benchmark,mwMulSmall,%u,%u", kernels.mulSmallRef, kernels.mulSmall);
+	vTelemetryPrintf("benchmark,mwMulMod,%u,%u", kernels.mulModRef, kernels.mulMod);
+	vTelemetryPrintf("benchmark,spigotPass,%u,%u", kernels.spigotRef, kernels.spigot);
+	vTaskDelay(pdMS_TO_TICKS(5000));
+#endif
+
 	for (;;)
 	{
-		uint32_t buttonState = (xEventGroupGetBits(evButtonEvents)) & 0x000000FF; // Read Button States from EventGroup
-		xEventGroupClearBits(evButtonEvents, EVBUTTONS_CLEAR);  // Clear all button event bits
+		// Sleep until a button, new values of the shown engine or the end of
+		// the period. A due redraw only waits for the display refresh, further
+		// values until then change nothing.
+		TickType_t now = xTaskGetTickCount();
+		EventBits_t waitBits = EVBUTTONS_ALL;
+		TickType_t wait = portMAX_DELAY;
+		if (redraw) {
+			TickType_t since = now - lastRender;
+			wait = (since < pdMS_TO_TICKS(PI_DISPLAY_MIN_MS)) ? pdMS_TO_TICKS(PI_DISPLAY_MIN_MS) - since : 0;
+		} else {
+			waitBits |= EVENGINE_PUBLISHED;
+		}
+		if (periodic) {
+			TickType_t left = ((int32_t)(nextPeriod - now) > 0) ? nextPeriod - now : 0;
+			wait = (left < wait) ? left : wait;
+		}
+		EventBits_t events = xEventGroupWaitBits(evButtonEvents, waitBits, pdTRUE, pdFALSE, wait);
+		uint32_t buttonState = events & EVBUTTONS_ALL;
+		if (buttonState != 0 || (events & waitBits & EVENGINE_PUBLISHED)) {
+			redraw = true;
+		}
+		const piEngine_t* engine = (currentEngine == PI_ENGINE_RACE) ? NULL : piEngines[currentEngine];
 
 		switch (buttonState)
 		{
 			case EVBUTTONS_S1: // Start
-			xSemaphoreGive(xStartSemaphore);
+			vPiEngineSend(PI_COMMAND_START);
 			break;
 
 			case EVBUTTONS_S2: // Stop
-			xSemaphoreGive(xStopSemaphore);
+			vPiEngineSend(PI_COMMAND_STOP);
 			break;
 			
 			case EVBUTTONS_S3: // Reset
-			xSemaphoreGive(xResetSemaphore);
-			if(currentAlgorithm == LEIBNIZ) {
-				startTimeLeibniz = xTaskGetTickCount(); // Reset start time for Leibniz
-				} else if(currentAlgorithm == NILKANTHA) {
-				startTimeNilkantha = xTaskGetTickCount(); // Reset start time for Nilkantha
-			}
+			vPiEngineSend(PI_COMMAND_RESET);
 			break;
 
 			case EVBUTTONS_S4: // Change Algorithm
-			if(currentAlgorithm == LEIBNIZ) {
-				// If currently on Leibniz, switch to Nilkantha
-				vTaskSuspend(xLeibnizTaskHandle);
-				vTaskResume(xNilkanthaTaskHandle);
-				currentAlgorithm = NILKANTHA;
-				} else {
-				// If currently on Nilkantha, switch to Leibniz
-				vTaskSuspend(xNilkanthaTaskHandle);
-				vTaskResume(xLeibnizTaskHandle);
-				currentAlgorithm = LEIBNIZ;
+			currentEngine = (currentEngine + 1) % (PI_ENGINE_COUNT + 1);
+			showMilestones = false;
+			showCpu = false;
+			page = 0;
+			// A sleeping worker picks up an engine that still runs
+			xTaskNotify(xPiEngineWorker, PI_COMMAND_SELECT, eSetBits);
+			break;
+
+			case EVBUTTONS_L1: // Long Start, engine specific
+			vPiEngineSendParameter(BUTTON1);
+			break;
+
+			case EVBUTTONS_L2: // Long Stop, engine specific
+			vPiEngineSendParameter(BUTTON2);
+			break;
+
+			case EVBUTTONS_L4: // Long Change Algorithm: milestone page of the engine
+			if (engine != NULL && engine->estimatesPi) {
+				showMilestones = !showMilestones;
+				page = 0;
+			}
+			break;
+
+#if (PI_RUNTIME_STATS == 1)
+			case EVBUTTONS_L3: // Long Reset: CPU page, the totals go out as telemetry
+			showCpu = !showCpu;
+			page = 0;
+			if (showCpu) {
+				vCpuDump(pxRunTimeStatsSample());
+#if (PI_TRACE == 1)
+				vTraceDump();
+#endif
 			}
 			break;
+#endif
 
 			default:
 			break;
 		}
 		
-		// Update elapsed time only if the approximation task is running
-		if (isLeibnizRunning && !piAccuracyAchievedLeibniz) {
-			elapsedTimeLeibniz = xTaskGetTickCount() - startTimeLeibniz;
+		// The worker keeps the elapsed time with every batch
+		now = xTaskGetTickCount();
+
+		// Once per period: step rates, page turns and a redraw for the clock
+		if (periodic && (int32_t)(now - nextPeriod) >= 0) {
+			TickType_t ratePeriod = now - lastRateTick;
+			for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++) {
+				uint32_t steps = xPiEngineSteps(i);
+				piEngineStatus[i].rate = ((steps - lastSteps[i]) * 1000UL) / (ratePeriod * portTICK_PERIOD_MS);
+				lastSteps[i] = steps;
+				if (piEngineStatus[i].rate > 0) {
+					etaRate[i] = piEngineStatus[i].rate;
+				}
+#if (PI_IDLE_COMPUTE == 1)
+				taskENTER_CRITICAL();
+				uint32_t restSteps = piEngineStatus[i].restSteps;
+				taskEXIT_CRITICAL();
+				uint32_t gain = ((restSteps - lastRestSteps[i]) * 1000UL) / (ratePeriod * portTICK_PERIOD_MS);
+				lastRestSteps[i] = restSteps;
+				if (piEngineStatus[i].rate > 0) {
+					vTelemetryPrintf("idle,%s,%lu,%lu", piEngines[i]->name, piEngineStatus[i].rate, gain);
+				}
+#endif
+			}
+			lastRateTick = now;
+			nextPeriod = now + pdMS_TO_TICKS(PI_DISPLAY_PERIOD_MS);
+			if ((currentEngine == PI_ENGINE_RACE || showMilestones || showCpu) && ++pagePeriods >= PI_RACE_PAGE_MS / PI_DISPLAY_PERIOD_MS) {
+				pagePeriods = 0;
+				page++;
+			}
+			redraw = true;
 		}
-		if (isNilkanthaRunning && !piAccuracyAchievedNilkantha) {
-			elapsedTimeNilkantha = xTaskGetTickCount() - startTimeNilkantha;
+
+		// Send new milestones with the predicted time and steps, an engine with
+		// fewer than sent was reset
+		for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++) {
+			const piEngine_t* sender = piEngines[i];
+			const piEngineStatus_t* status = &piEngineStatus[i];
+			if (status->decades < milestonesSent[i]) {
+				milestonesSent[i] = 0;
+			}
+			while (milestonesSent[i] < status->decades) {
+				uint8_t decade = milestonesSent[i] + 1;
+				piMilestone_t milestone = xMilestone(status, decade - 1);
+				vTelemetryPrintf("milestone,%s,%u,%lu,%lu,%lu,%lu", sender->name, decade,
+					milestone.time, milestone.steps, xPredictedTime(i, decade),
+					(sender->stepsFor != NULL) ? sender->stepsFor(sender->state, decade) : 0UL);
+				milestonesSent[i]++;
+			}
+			taskENTER_CRITICAL();
+			uint8_t commands = status->commands;
+			uint8_t command = status->command;
+			TickType_t latency = status->commandLatency;
+			taskEXIT_CRITICAL();
+			if (commands != commandsSent[i]) {
+				vTelemetryPrintf("command,%s,%u,%lu", sender->name, command, latency * portTICK_PERIOD_MS);
+				commandsSent[i] = commands;
+			}
 		}
 
-		// Display current algorithm's approximation of pi
-		if (currentAlgorithm == LEIBNIZ)
-		{
-			char pistringLeibniz[20];
-			char timeStringLeibniz[20];
-			
-			vDisplayClear();
-			vDisplayWriteStringAtPos(0, 0, "Leibniz Series");
-			sprintf(pistringLeibniz, "PI: %.8f", pi_approximation_leibniz);
-			vDisplayWriteStringAtPos(1, 0, "%s", pistringLeibniz);
-			
-			sprintf(timeStringLeibniz, "Time: %lu ms", elapsedTimeLeibniz);
-			vDisplayWriteStringAtPos(2, 0, "%s", timeStringLeibniz);
+		// The clock, the rates and the pages need the period, a still screen
+		// sleeps until the next event. Idle, the period starts over from now.
+		periodic = (currentEngine == PI_ENGINE_RACE) || showMilestones || showCpu;
+		for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++) {
+			if ((piEngineStatus[i].running && !piEngineStatus[i].finished) || piEngineStatus[i].rate != 0) {
+				periodic = true;
+			}
+		}
+		if (!periodic) {
+			lastRateTick = now;
+			nextPeriod = now + pdMS_TO_TICKS(PI_DISPLAY_PERIOD_MS);
+			for (uint8_t i = 0; i < PI_ENGINE_COUNT; i++) {
+				lastSteps[i] = xPiEngineSteps(i);
+			}
 		}
 
-		if (currentAlgorithm == NILKANTHA)
-		{
-			char pistringNilkantha[20];
-			char timeStringNilkantha[20];
-			
-			vDisplayClear();
-			vDisplayWriteStringAtPos(0, 0, "Nilkantha Method");
-			sprintf(pistringNilkantha, "PI: %.8f", pi_approximation_nilkantha);
-			vDisplayWriteStringAtPos(1, 0, "%s", pistringNilkantha);
-			
-			sprintf(timeStringNilkantha, "Time: %lu ms", elapsedTimeNilkantha);
-			vDisplayWriteStringAtPos(2, 0, "%s", timeStringNilkantha);
+		if (!redraw || (now - lastRender) < pdMS_TO_TICKS(PI_DISPLAY_MIN_MS)) {
+			continue;
 		}
-		
-		vDisplayWriteStringAtPos(3, 0, "#STR #STP #RST #CALG");
+		// Values published from here on wake the next redraw
+		xEventGroupClearBits(evButtonEvents, EVENGINE_PUBLISHED);
+		redraw = false;
+		lastRender = now;
 
-		vTaskDelay(pdMS_TO_TICKS(500));
+		// Display current algorithm's approximation of pi, the race leaderboard
+		// or the milestones of the current engine
+		memset(lines, 0, sizeof(lines));
+#if (PI_RUNTIME_STATS == 1)
+		if (showCpu) {
+			const runTimeStats_t* stats = pxRunTimeStatsSample();
+			page %= xCpuPages(stats);
+			vCpuFormat(stats, page, lines);
+		} else
+#endif
+		if (currentEngine == PI_ENGINE_RACE) {
+			// Pages: decimals 1-3, time 1-3, decimals 4-6, time 4-6
+			uint8_t racePages = 2 * ((PI_ENGINE_COUNT + PI_ENGINE_LINES - 1) / PI_ENGINE_LINES);
+			page %= racePages;
+			vRaceFormat(page, lines);
+		} else if (showMilestones) {
+			// The ETA comes first for engines with a closed-form error
+			bool eta = (piEngines[currentEngine]->stepsFor != NULL);
+			if (page >= xMilestonePages(currentEngine) + eta) {
+				page = 0;	// wrapped, or the engine was reset
+			}
+			if (eta && page == 0) {
+				vEtaFormat(currentEngine, etaRate[currentEngine], lines);
+			} else {
+				vMilestoneFormat(currentEngine, page - eta, lines);
+			}
+		} else {
+			engine = piEngines[currentEngine];
+			engine->result(engine->state, &piEngineStatus[currentEngine], lines);
+		}
+
+		vDisplayClear();
+		for (uint8_t line = 0; line < PI_ENGINE_LINES; line++) {
+			vDisplayWriteStringAtPos(line, 0, "%s", lines[line]);
+		}
+		vDisplayWriteStringAtPos(3, 0, "#STR #STP #RST #CALG");
 	}
 }
 
@@ -336,6 +1109,18 @@ void vButtonHandler(void* pvParameters) {
 		if(getButtonPress(BUTTON4) == SHORT_PRESSED) {
 			xEventGroupSetBits(evButtonEvents, EVBUTTONS_S4);
 		}
+		if(getButtonPress(BUTTON1) == LONG_PRESSED) {
+			xEventGroupSetBits(evButtonEvents, EVBUTTONS_L1);
+		}
+		if(getButtonPress(BUTTON2) == LONG_PRESSED) {
+			xEventGroupSetBits(evButtonEvents, EVBUTTONS_L2);
+		}
+		if(getButtonPress(BUTTON4) == LONG_PRESSED) {
+			xEventGroupSetBits(evButtonEvents, EVBUTTONS_L4);
+		}
+		if(getButtonPress(BUTTON3) == LONG_PRESSED) {
+			xEventGroupSetBits(evButtonEvents, EVBUTTONS_L3);
+		}
 
 		vTaskDelay((1000/BUTTON_UPDATE_FREQUENCY_HZ)/portTICK_RATE_MS);
 	}
@@ -0,0 +1,243 @@
+/*
+ * multiword.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "multiword.h"
+
+void mwSetInt(mword_t *a, uint16_t n, uint16_t value)
+{
+	a[0] = value;
+	for (uint16_t i = 1; i < n; i++) {
+		a[i] = 0;
+	}
+}
+
+void mwCopy(mword_t *dst, const mword_t *src, uint16_t n)
+{
+	for (uint16_t i = 0; i < n; i++) {
+		dst[i] = src[i];
+	}
+}
+
+bool mwIsZero(const mword_t *a, uint16_t n)
+{
+	return mwLeadingZeroWords(a, n) == n;
+}
+
+uint16_t mwLeadingZeroWords(const mword_t *a, uint16_t n)
+{
+	uint16_t i = 0;
+	while (i < n && a[i] == 0) {
+		i++;
+	}
+	return i;
+}
+
+uint16_t mwDivSmallRef(mword_t *dst, const mword_t *src, uint16_t n, uint16_t divisor)
+{
+	uint16_t remainder = 0;
+
+	// Schoolbook division from the top, 32/16 bit per word
+	for (uint16_t i = 0; i < n; i++) {
+		uint32_t x = ((uint32_t)remainder << MWORD_BITS) | src[i];
+		dst[i] = (mword_t)(x / divisor);
+		remainder = (uint16_t)(x % divisor);
+	}
+	return remainder;
+}
+
+uint16_t mwMulSmallRef(mword_t *a, uint16_t n, uint16_t factor)
+{
+	uint16_t carry = 0;
+
+	for (uint16_t i = n; i > 0; i--) {
+		uint32_t x = (uint32_t)a[i - 1] * factor + carry;
+		a[i - 1] = (mword_t)x;
+		carry = (uint16_t)(x >> MWORD_BITS);
+	}
+	return carry;
+}
+
+uint16_t mwMulModRef(uint16_t a, uint16_t b, uint16_t m)
+{
+	return (uint16_t)(((uint32_t)a * b) % m);
+}
+
+#if (PI_MULTIWORD_ASM == 0)
+
+uint16_t mwDivSmall(mword_t *dst, const mword_t *src, uint16_t n, uint16_t divisor)
+{
+	return mwDivSmallRef(dst, src, n, divisor);
+}
+
+uint16_t mwMulSmall(mword_t *a, uint16_t n, uint16_t factor)
+{
+	return mwMulSmallRef(a, n, factor);
+}
+
+uint16_t mwMulMod(uint16_t a, uint16_t b, uint16_t m)
+{
+	return mwMulModRef(a, b, m);
+}
+
+#endif
+
+void mwAdd(mword_t *dst, const mword_t *src, uint16_t n)
+{
+	uint8_t carry = 0;
+
+	for (uint16_t i = n; i > 0; i--) {
+		uint32_t x = (uint32_t)dst[i - 1] + src[i - 1] + carry;
+		dst[i - 1] = (mword_t)x;
+		carry = (uint8_t)(x >> MWORD_BITS);
+	}
+}
+
+void mwSub(mword_t *dst, const mword_t *src, uint16_t n)
+{
+	uint8_t borrow = 0;
+
+	for (uint16_t i = n; i > 0; i--) {
+		uint32_t x = (uint32_t)dst[i - 1] - src[i - 1] - borrow;
+		dst[i - 1] = (mword_t)x;
+		borrow = (x >> MWORD_BITS) ? 1 : 0;
+	}
+}
+
+void mwMul(mword_t *dst, const mword_t *a, const mword_t *b, uint16_t n)
+{
+	// Product scanning from the least significant kept column upwards. Column c
+	// only reads words up to index c, so writing dst[c] afterwards is alias safe.
+	// Column n is summed for its carry only, the columns below it are dropped.
+	uint32_t acc = 0;
+	uint16_t accHigh = 0;
+
+	for (uint16_t c = n + 1; c > 0; c--) {
+		uint16_t column = c - 1;
+		uint16_t first = (column >= n) ? column - n + 1 : 0;
+
+		for (uint16_t i = first; i <= column; i++) {
+			uint32_t product = (uint32_t)a[i] * b[column - i];
+			acc += product;
+			if (acc < product) {
+				accHigh++;
+			}
+		}
+		if (column < n) {
+			dst[column] = (mword_t)acc;
+		}
+		acc = (acc >> MWORD_BITS) | ((uint32_t)accHigh << MWORD_BITS);
+		accHigh = 0;
+	}
+}
+
+uint16_t mwIsqrt32(uint32_t x)
+{
+	if (x == 0) {
+		return 0;
+	}
+
+	// Seed above the root: 2^ceil(bits/2), then Newton descends monotonically
+	uint8_t bits = 0;
+	for (uint32_t v = x; v != 0; v >>= 1) {
+		bits++;
+	}
+	uint32_t r = (uint32_t)1 << ((bits + 1) / 2);
+
+	for (;;) {
+		uint32_t next = (r + x / r) / 2;
+		if (next >= r) {
+			return (uint16_t)r;
+		}
+		r = next;
+	}
+}
+
+// Newton steps only need the precision they produce: the word count grows
+// from the 16-bit seed like the correct bits do, two steps run at full length.
+static uint16_t nextPrecision(uint16_t m, uint16_t n)
+{
+	if (m >= n) {
+		return n;
+	}
+	m = 2 * m - 1;
+	return (m > n) ? n : m;
+}
+
+void mwReciprocal(mword_t *dst, const mword_t *x, uint16_t n, mword_t *scratch)
+{
+	mword_t *xy = scratch;
+	mword_t *correction = scratch + n;
+
+	// Seed 2^32 / x in Q16.16 from the two leading words
+	uint32_t x32 = ((uint32_t)x[0] << MWORD_BITS) | x[1];
+	uint32_t y32 = 0xFFFFFFFFUL / x32;
+	mwSetInt(dst, n, (uint16_t)(y32 >> MWORD_BITS));
+	dst[1] = (mword_t)y32;
+
+	uint16_t m = 2;
+	for (uint8_t finalSteps = 0; finalSteps < 2; ) {
+		m = nextPrecision(m, n);
+		mwMul(xy, x, dst, m);
+		mwSetInt(correction, m, 2);
+		mwSub(correction, xy, m);
+		mwMul(dst, dst, correction, m);
+		if (m == n) {
+			finalSteps++;
+		}
+	}
+}
+
+void mwSqrt(mword_t *dst, const mword_t *x, uint16_t n, mword_t *scratch)
+{
+	mword_t *y = scratch;
+	mword_t *xy2 = scratch + n;
+	mword_t *correction = scratch + 2 * n;
+
+	// Seed 1/sqrt(x) in Q16.16: isqrt(x * 2^30) = sqrt(x) * 2^15
+	uint32_t x32 = ((uint32_t)x[0] << MWORD_BITS) | x[1];
+	uint32_t y32 = 0x80000000UL / mwIsqrt32(x32 << 14);
+	mwSetInt(y, n, (uint16_t)(y32 >> MWORD_BITS));
+	y[1] = (mword_t)y32;
+
+	uint16_t m = 2;
+	for (uint8_t finalSteps = 0; finalSteps < 2; ) {
+		m = nextPrecision(m, n);
+		mwMul(xy2, y, y, m);
+		mwMul(xy2, xy2, x, m);
+		mwSetInt(correction, m, 3);
+		mwSub(correction, xy2, m);
+		mwMul(y, y, correction, m);
+		mwDivSmall(y, y, m, 2);
+		if (m == n) {
+			finalSteps++;
+		}
+	}
+	mwMul(dst, x, y, n);
+}
+
+void mwFormat(char *buffer, const mword_t *a, uint16_t n, uint16_t count, mword_t *scratch)
+{
+	mwCopy(scratch, a, n);
+	*buffer++ = '0' + scratch[0];
+	*buffer++ = '.';
+
+	// Four decimals per pass: the integer word of frac * 10000
+	while (count > 0) {
+		scratch[0] = 0;
+		mwMulSmall(scratch, n, 10000);
+		uint16_t group = scratch[0];
+		uint8_t digits = (count < 4) ? (uint8_t)count : 4;
+		for (uint8_t i = 4; i > 0; i--) {
+			if (i <= digits) {
+				buffer[i - 1] = '0' + (group % 10);
+			}
+			group /= 10;
+		}
+		buffer += digits;
+		count -= digits;
+	}
+	*buffer = '\0';
+}
@@ -0,0 +1,33 @@
+/*
+ * neumaierSum.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <math.h>
+#include "neumaierSum.h"
+
+void neumaierInit(neumaierSum_t *accumulator, float value)
+{
+	accumulator->sum = value;
+	accumulator->compensation = 0.0f;
+}
+
+void neumaierAdd(neumaierSum_t *accumulator, float term)
+{
+	float sum = accumulator->sum;
+	float t = sum + term;
+
+	// Recover the part of the smaller operand that got rounded away
+	if (fabsf(sum) >= fabsf(term)) {
+		accumulator->compensation += (sum - t) + term;
+	} else {
+		accumulator->compensation += (term - t) + sum;
+	}
+	accumulator->sum = t;
+}
+
+float neumaierValue(const neumaierSum_t *accumulator)
+{
+	return accumulator->sum + accumulator->compensation;
+}
@@ -0,0 +1,90 @@
+/*
+ * nvStoreEeprom.c
+ *
+ * Created: 16.10.2026
+ *
+ * nvStore on the XMEGA EEPROM through the NVM controller. Writes go page by
+ * page: the changed bytes are loaded into the page buffer and written with
+ * one atomic erase & write, which only touches the loaded bytes. avr-libc's
+ * eeprom_update_block() would start a page write for every single byte.
+ */
+
+#include <stdbool.h>
+#include "avr_compiler.h"
+#include "clksys_driver.h"
+#include "nvStore.h"
+
+static void eepromWaitForNvm(void)
+{
+	while (NVM.STATUS & NVM_NVMBUSY_bm) {
+	}
+}
+
+static void eepromSetAddress(uint16_t address)
+{
+	NVM.ADDR0 = address & 0xFF;
+	NVM.ADDR1 = (address >> 8) & 0x1F;
+	NVM.ADDR2 = 0x00;
+}
+
+// Executes the command in NVM.CMD, CMDEX is protected by the CCP
+static void eepromExecute(uint8_t command)
+{
+	NVM.CMD = command;
+	CCPWrite(&NVM.CTRLA, NVM_CMDEX_bm);
+	eepromWaitForNvm();
+	NVM.CMD = NVM_CMD_NO_OPERATION_gc;
+}
+
+static uint8_t eepromReadByte(uint16_t address)
+{
+	eepromWaitForNvm();
+	eepromSetAddress(address);
+	eepromExecute(NVM_CMD_READ_EEPROM_gc);
+	return NVM.DATA0;
+}
+
+static void eepromRead(uint16_t address, void *data, uint16_t length)
+{
+	uint8_t *byte = data;
+
+	while (length-- > 0) {
+		*byte++ = eepromReadByte(address++);
+	}
+}
+
+static void eepromWrite(uint16_t address, const void *data, uint16_t length)
+{
+	const uint8_t *byte = data;
+
+	while (length > 0) {
+		uint16_t page = address & ~(uint16_t)(EEPROM_PAGE_SIZE - 1);
+		bool loaded = false;
+
+		// A buffer left loaded by an earlier write would be written as well
+		eepromWaitForNvm();
+		if (NVM.STATUS & NVM_EELOAD_bm) {
+			eepromExecute(NVM_CMD_ERASE_EEPROM_BUFFER_gc);
+		}
+
+		// Load the bytes of this page that change
+		for (; length > 0 && (address & ~(uint16_t)(EEPROM_PAGE_SIZE - 1)) == page; address++, byte++, length--) {
+			if (eepromReadByte(address) != *byte) {
+				NVM.CMD = NVM_CMD_LOAD_EEPROM_BUFFER_gc;
+				eepromSetAddress(address);
+				NVM.DATA0 = *byte;
+				loaded = true;
+			}
+		}
+		if (loaded) {
+			eepromSetAddress(page);
+			eepromExecute(NVM_CMD_ERASE_WRITE_EEPROM_PAGE_gc);
+		}
+	}
+}
+
+const nvStore_t nvStoreEeprom = {
+	.read = eepromRead,
+	.write = eepromWrite,
+	.size = EEPROM_SIZE,
+};
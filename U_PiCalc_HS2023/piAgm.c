@@ -0,0 +1,122 @@
+/*
+ * piAgm.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "piAgm.h"
+
+// log10(2^16) = 4.8165, scaled by 1000
+#define DECIMALS_PER_WORD_X1000	4816UL
+
+static void estimate(agmState_t *state)
+{
+	uint16_t n = state->words;
+	mword_t *sum = state->scratch;
+	mword_t *reciprocal = state->scratch + n;
+
+	// pi = (a + b)^2 / (4t)
+	mwCopy(sum, state->a, n);
+	mwAdd(sum, state->b, n);
+	mwMul(sum, sum, sum, n);
+	mwReciprocal(reciprocal, state->t, n, state->scratch + 2 * n);
+	mwMul(state->pi, sum, reciprocal, n);
+	mwDivSmall(state->pi, state->pi, n, 4);
+}
+
+void agmInit(agmState_t *state, mword_t *buffer, uint16_t words)
+{
+	state->a = buffer;
+	state->b = buffer + words;
+	state->t = buffer + 2 * words;
+	state->pi = buffer + 3 * words;
+	state->scratch = buffer + 4 * words;
+	state->words = words;
+	state->p = 1;
+	state->matchingWords = 0;
+	state->iterations = 0;
+	state->done = false;
+
+	// a = 1, b = 1/sqrt(2), t = 1/4
+	mwSetInt(state->a, words, 1);
+	mwSetInt(state->b, words, 0);
+	state->b[1] = 0x8000;
+	mwSqrt(state->b, state->b, words, state->scratch);
+	mwSetInt(state->t, words, 0);
+	state->t[1] = 0x4000;
+	estimate(state);
+}
+
+bool agmStep(agmState_t *state)
+{
+	if (state->done) {
+		return false;
+	}
+
+	uint16_t n = state->words;
+	mword_t *next = state->scratch;
+	mword_t *product = state->pi;	// recomputed by estimate() below
+
+	// a' = (a + b) / 2, b' = sqrt(a * b)
+	mwCopy(next, state->a, n);
+	mwAdd(next, state->b, n);
+	mwDivSmall(next, next, n, 2);
+	mwMul(product, state->a, state->b, n);
+
+	// t -= p * (a - a')^2, with a - a' = (a - b) / 2 >= 0
+	mwSub(state->a, next, n);
+	mwMul(state->a, state->a, state->a, n);
+	mwMulSmall(state->a, n, state->p);
+	mwSub(state->t, state->a, n);
+
+	mwCopy(state->a, next, n);
+	mwSqrt(state->b, product, n, state->scratch + n);
+	state->p *= 2;
+	state->iterations++;
+
+	// a - b shrinks quadratically and the error of the estimate is about
+	// (a - b)^2, so it is final once half of the fraction words agree
+	mwCopy(next, state->a, n);
+	mwSub(next, state->b, n);
+	uint16_t zeroWords = mwLeadingZeroWords(next, n);
+	state->matchingWords = (zeroWords > 0) ? zeroWords - 1 : 0;
+	if (2 * state->matchingWords >= n - 1 - AGM_GUARD_WORDS) {
+		state->done = true;
+	}
+
+	estimate(state);
+	return true;
+}
+
+uint16_t agmDigits(const agmState_t *state)
+{
+	if (state->done) {
+		return agmDigitsTotal(state);
+	}
+	// Twice the matching words, less two digits for the rounding of the bound
+	uint16_t words = 2 * state->matchingWords;
+	uint16_t digits = (uint16_t)((words * DECIMALS_PER_WORD_X1000) / 1000);
+	digits = (digits > 2) ? digits - 2 : 0;
+	uint16_t total = agmDigitsTotal(state);
+	return (digits > total) ? total : digits;
+}
+
+uint16_t agmDigitsTotal(const agmState_t *state)
+{
+	uint16_t words = state->words - 1 - AGM_GUARD_WORDS;
+	return (uint16_t)((words * DECIMALS_PER_WORD_X1000) / 1000);
+}
+
+uint32_t agmErrorQ32(const agmState_t *state)
+{
+	if (state->pi[0] != 3) {
+		return 0xFFFFFFFFUL;
+	}
+	uint32_t fraction = ((uint32_t)state->pi[1] << MWORD_BITS) | state->pi[2];
+	return (fraction > AGM_PI_FRACTION_Q32) ? fraction - AGM_PI_FRACTION_Q32 : AGM_PI_FRACTION_Q32 - fraction;
+}
+
+void agmFormat(agmState_t *state, char *buffer, uint16_t count)
+{
+	mwFormat(buffer, state->pi, state->words, count, state->scratch);
+}
@@ -0,0 +1,125 @@
+/*
+ * piBbp.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "piBbp.h"
+#include "multiword.h"
+
+// Tail terms 16^(d-k)/(8k+j) for k > d, beyond 8 they are below 2^-32
+#define BBP_TAIL_TERMS	8
+
+static const uint8_t seriesOffset[4] = { 1, 4, 5, 6 };
+
+#if (BBP_RESIDUE_BITS == 16)
+
+typedef uint16_t bbpResidue_t;
+
+static bbpResidue_t powMod16(uint32_t exponent, bbpResidue_t modulus)
+{
+	// 16^exponent mod modulus by binary exponentiation, all products < 2^32
+	bbpResidue_t result = 1 % modulus;
+	bbpResidue_t base = 16 % modulus;
+
+	while (exponent > 0) {
+		if (exponent & 1) {
+			result = mwMulMod(result, base, modulus);
+		}
+		base = mwMulMod(base, base, modulus);
+		exponent >>= 1;
+	}
+	return result;
+}
+
+static uint32_t fractionOf(bbpResidue_t numerator, bbpResidue_t modulus)
+{
+	// numerator / modulus as Q0.32: the two fraction words of a three-word
+	// division, the integer word is 0 as numerator < modulus
+	mword_t words[3] = { numerator, 0, 0 };
+	mwDivSmall(words, words, 3, modulus);
+	return ((uint32_t)words[1] << MWORD_BITS) | words[2];
+}
+
+#else
+
+typedef uint32_t bbpResidue_t;
+
+static bbpResidue_t powMod16(uint32_t exponent, bbpResidue_t modulus)
+{
+	uint64_t result = 1 % modulus;
+	uint64_t base = 16 % modulus;
+
+	while (exponent > 0) {
+		if (exponent & 1) {
+			result = (result * base) % modulus;
+		}
+		base = (base * base) % modulus;
+		exponent >>= 1;
+	}
+	return (bbpResidue_t)result;
+}
+
+static uint32_t fractionOf(bbpResidue_t numerator, bbpResidue_t modulus)
+{
+	return (uint32_t)(((uint64_t)numerator << 32) / modulus);
+}
+
+#endif
+
+void bbpInit(bbpState_t *state, uint32_t position)
+{
+	if (position < 1) {
+		position = 1;
+	}
+	if (position > BBP_MAX_POSITION) {
+		position = BBP_MAX_POSITION;
+	}
+	state->position = position;
+	state->k = 0;
+	state->done = false;
+	for (uint8_t j = 0; j < 4; j++) {
+		state->sums[j] = 0;
+	}
+}
+
+bool bbpStep(bbpState_t *state)
+{
+	if (state->done) {
+		return false;
+	}
+
+	uint32_t d = state->position - 1;
+	uint32_t k = state->k;
+
+	if (k <= d) {
+		// Head: frac(16^(d-k) mod (8k+j) / (8k+j)), the Q0.32 sums wrap modulo 1
+		for (uint8_t j = 0; j < 4; j++) {
+			bbpResidue_t modulus = (bbpResidue_t)(8 * k + seriesOffset[j]);
+			state->sums[j] += fractionOf(powMod16(d - k, modulus), modulus);
+		}
+		state->k++;
+		return true;
+	}
+
+	// Tail: 16^(d-k) / (8k+j) = 2^(32 - 4(k-d)) / (8k+j) in Q0.32
+	for (uint8_t i = 1; i < BBP_TAIL_TERMS; i++) {
+		for (uint8_t j = 0; j < 4; j++) {
+			uint32_t modulus = 8 * (d + i) + seriesOffset[j];
+			state->sums[j] += (((uint32_t)1 << (32 - 4 * i)) / modulus);
+		}
+	}
+	state->done = true;
+	return false;
+}
+
+uint32_t bbpFraction(const bbpState_t *state)
+{
+	// pi = 4*S1 - 2*S4 - S5 - S6, modulo 1 by unsigned wrap-around
+	return 4 * state->sums[0] - 2 * state->sums[1] - state->sums[2] - state->sums[3];
+}
+
+uint8_t bbpDigit(const bbpState_t *state)
+{
+	return (uint8_t)(bbpFraction(state) >> 28);
+}
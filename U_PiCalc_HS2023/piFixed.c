@@ -0,0 +1,65 @@
+/*
+ * piFixed.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "piFixed.h"
+
+// Largest k for which the Nilkantha denominator still fits the numerator
+// width: (2k+4)^3 <= 2^31 resp. 2^63, the 64-bit bound is reached exactly
+// (terms beyond are below one LSB anyway).
+#define NILKANTHA32_MAX_K	640UL
+#define NILKANTHA64_MAX_K	1048574UL
+
+fixed32_t fixed32LeibnizTerm(uint32_t k)
+{
+	uint32_t d = 2 * k + 1;
+
+	// Rounded reciprocal, so the truncation error of the alternating terms cancels
+	return (fixed32_t)(((uint32_t)FIXED32_ONE + (d >> 1)) / d);
+}
+
+fixed64_t fixed64LeibnizTerm(uint32_t k)
+{
+	uint32_t d = 2 * k + 1;
+
+	return (fixed64_t)(((uint64_t)FIXED64_ONE + (d >> 1)) / d);
+}
+
+fixed32_t fixed32NilkanthaTerm(uint32_t k)
+{
+	if (k > NILKANTHA32_MAX_K) {
+		return 0;
+	}
+	uint16_t a = (uint16_t)(2 * k + 2);
+
+	// 16x16 products map onto the MUL instruction, only the last one is 32-bit
+	uint32_t d = (uint32_t)a * (uint16_t)(a + 1);
+	d *= (uint16_t)(a + 2);
+
+	return (fixed32_t)((((uint32_t)4 << FIXED32_FRAC_BITS) + (d >> 1)) / d);
+}
+
+fixed64_t fixed64NilkanthaTerm(uint32_t k)
+{
+	if (k > NILKANTHA64_MAX_K) {
+		return 0;
+	}
+	uint32_t a = 2 * k + 2;
+	uint64_t d = (uint64_t)a * (a + 1);
+	d *= (a + 2);
+
+	return (fixed64_t)(((uint64_t)4 * FIXED64_ONE + (d >> 1)) / d);
+}
+
+float fixed32ToFloat(fixed32_t value)
+{
+	return (float)value / (float)FIXED32_ONE;
+}
+
+float fixed64ToFloat(fixed64_t value)
+{
+	// Drop the low bits first, the float mantissa can not hold them anyway
+	return (float)(int32_t)(value >> 32) / (float)((fixed64_t)1 << (FIXED64_FRAC_BITS - 32));
+}
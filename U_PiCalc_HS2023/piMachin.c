@@ -0,0 +1,96 @@
+/*
+ * piMachin.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "piMachin.h"
+
+// log10(2^16) = 4.8165, scaled by 1000
+#define DECIMALS_PER_WORD_X1000	4816UL
+
+static void startSeries(machinState_t *state, uint16_t x, uint16_t factor)
+{
+	// power = factor / x
+	state->x = x;
+	state->k = 0;
+	state->zeroWords = 0;
+	mwSetInt(state->power, state->words, factor);
+	mwDivSmall(state->power, state->power, state->words, x);
+}
+
+void machinInit(machinState_t *state, mword_t *buffer, uint16_t words)
+{
+	state->sum = buffer;
+	state->power = buffer + words;
+	state->term = buffer + 2 * words;
+	state->words = words;
+	state->terms = 0;
+	state->done = false;
+	mwSetInt(state->sum, words, 0);
+
+	// The short 239 series runs first, so the digit count of the
+	// 5 series is the real progress of the result
+	startSeries(state, 239, 4);
+}
+
+bool machinStep(machinState_t *state)
+{
+	if (state->done) {
+		return false;
+	}
+
+	uint16_t n = state->words;
+	uint16_t z = state->zeroWords;
+
+	// term = power / (2k+1), the zero words on top stay zero
+	mwSetInt(state->term, z, 0);
+	mwDivSmall(state->term + z, state->power + z, n - z, 2 * state->k + 1);
+
+	// 16*arctan(1/5) counts positive, 4*arctan(1/239) negative
+	bool add = ((state->k & 1) == 0) == (state->x == 5);
+	if (add) {
+		mwAdd(state->sum, state->term, n);
+	} else {
+		mwSub(state->sum, state->term, n);
+	}
+	state->k++;
+	state->terms++;
+
+	// power /= x^2, one division since 239^2 still fits 16 bits
+	mwDivSmall(state->power + z, state->power + z, n - z, (uint16_t)((uint32_t)state->x * state->x));
+	state->zeroWords = z + mwLeadingZeroWords(state->power + z, n - z);
+
+	if (state->zeroWords == n) {
+		if (state->x == 239) {
+			startSeries(state, 5, 16);
+		} else {
+			state->done = true;
+		}
+	}
+	return true;
+}
+
+uint16_t machinDigits(const machinState_t *state)
+{
+	if (state->x == 239) {
+		return 0;
+	}
+	if (state->done) {
+		return machinDigitsTotal(state);
+	}
+	// The remaining error is below the current power
+	uint16_t words = (state->zeroWords > 1) ? state->zeroWords - 1 : 0;
+	return (uint16_t)((words * DECIMALS_PER_WORD_X1000) / 1000);
+}
+
+uint16_t machinDigitsTotal(const machinState_t *state)
+{
+	uint16_t words = state->words - 1 - MACHIN_GUARD_WORDS;
+	return (uint16_t)((words * DECIMALS_PER_WORD_X1000) / 1000);
+}
+
+void machinFormat(machinState_t *state, char *buffer, uint16_t count)
+{
+	mwFormat(buffer, state->sum, state->words, count, state->term);
+}
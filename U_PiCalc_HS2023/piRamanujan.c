@@ -0,0 +1,131 @@
+/*
+ * piRamanujan.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "piRamanujan.h"
+
+// log10(2^16) = 4.8165, scaled by 1000
+#define DECIMALS_PER_WORD_X1000	4816UL
+
+// log10(396^4 / 256) = 7.9825 decimals per term, scaled by 1000. After K
+// terms the error is about 10^-(8K-1), two digits are kept as margin.
+#define DECIMALS_PER_TERM_X1000	7982UL
+#define DECIMALS_MARGIN			2
+
+static void estimate(ramanujanState_t *state)
+{
+	uint16_t n = state->words;
+	mword_t *sum = state->scratch;
+
+	// S = 1103 * sum + 26390 * sumK, about 1103, scaled by 1/1024 into the
+	// range of mwReciprocal(); pi holds the second product for a moment
+	mwCopy(sum, state->sum, n);
+	mwMulSmall(sum, n, 1103);
+	mwCopy(state->pi, state->sumK, n);
+	mwMulSmall(state->pi, n, 26390);
+	mwAdd(sum, state->pi, n);
+	mwDivSmall(sum, sum, n, 1024);
+
+	// pi = 9801 / (2 * sqrt(2) * S) = constant / (S / 1024)
+	mwReciprocal(state->pi, sum, n, state->scratch + n);
+	mwMul(state->pi, state->pi, state->constant, n);
+}
+
+void ramanujanInit(ramanujanState_t *state, mword_t *buffer, uint16_t words)
+{
+	state->t = buffer;
+	state->sum = buffer + words;
+	state->sumK = buffer + 2 * words;
+	state->constant = buffer + 3 * words;
+	state->pi = buffer + 4 * words;
+	state->scratch = buffer + 5 * words;
+	state->words = words;
+	state->k = 0;
+	state->zeroWords = 0;
+	state->done = false;
+
+	// constant = 9801 * sqrt(2) / 4096
+	mwSetInt(state->constant, words, 2);
+	mwSqrt(state->constant, state->constant, words, state->scratch);
+	mwMulSmall(state->constant, words, 9801);
+	mwDivSmall(state->constant, state->constant, words, 4096);
+
+	// t_0 = 1, no terms yet
+	mwSetInt(state->t, words, 1);
+	mwSetInt(state->sum, words, 0);
+	mwSetInt(state->sumK, words, 0);
+	mwSetInt(state->pi, words, 0);
+}
+
+bool ramanujanStep(ramanujanState_t *state)
+{
+	if (state->done) {
+		return false;
+	}
+
+	uint16_t n = state->words;
+	uint16_t k = state->k;
+
+	// sum += t_k, sumK += k * t_k
+	mwAdd(state->sum, state->t, n);
+	mwCopy(state->scratch, state->t, n);
+	mwMulSmall(state->scratch, n, k);
+	mwAdd(state->sumK, state->scratch, n);
+
+	// t_k+1 = t_k * (4k+1)(4k+2)(4k+3)(4k+4) / ((k+1)^4 396^4)
+	//       = t_k * 8(2k+1) * (4k+1) * (4k+3) / (396(k+1))^3 / 396
+	// The products grow by less than 2^31, so two of the zero words on top
+	// take the overflow; the divisions bring t back below the old value.
+	uint16_t z = (state->zeroWords > 2) ? state->zeroWords - 2 : 0;
+	mword_t *t = state->t + z;
+	uint16_t m = n - z;
+	uint16_t divisor = 396 * (k + 1);
+	mwMulSmall(t, m, 8 * (2 * k + 1));
+	mwMulSmall(t, m, 4 * k + 1);
+	mwMulSmall(t, m, 4 * k + 3);
+	mwDivSmall(t, t, m, divisor);
+	mwDivSmall(t, t, m, divisor);
+	mwDivSmall(t, t, m, divisor);
+	mwDivSmall(t, t, m, 396);
+	state->zeroWords = z + mwLeadingZeroWords(t, m);
+	state->k = k + 1;
+
+	// The next terms fall below the last word
+	if (state->zeroWords == n) {
+		state->done = true;
+	}
+
+	estimate(state);
+	return true;
+}
+
+uint16_t ramanujanDigits(const ramanujanState_t *state)
+{
+	uint16_t total = ramanujanDigitsTotal(state);
+
+	if (state->done) {
+		return total;
+	}
+	uint32_t digits = ((uint32_t)state->k * DECIMALS_PER_TERM_X1000) / 1000;
+	digits = (digits > DECIMALS_MARGIN) ? digits - DECIMALS_MARGIN : 0;
+	return (digits > total) ? total : (uint16_t)digits;
+}
+
+uint16_t ramanujanDigitsTotal(const ramanujanState_t *state)
+{
+	uint16_t words = state->words - 1 - RAMANUJAN_GUARD_WORDS;
+	return (uint16_t)((words * DECIMALS_PER_WORD_X1000) / 1000);
+}
+
+uint16_t ramanujanTermsFor(uint16_t digits)
+{
+	uint32_t scaled = ((uint32_t)digits + DECIMALS_MARGIN) * 1000;
+	return (uint16_t)((scaled + DECIMALS_PER_TERM_X1000 - 1) / DECIMALS_PER_TERM_X1000);
+}
+
+void ramanujanFormat(ramanujanState_t *state, char *buffer, uint16_t count)
+{
+	mwFormat(buffer, state->pi, state->words, count, state->scratch);
+}
@@ -0,0 +1,194 @@
+/*
+ * piReference.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <avr/pgmspace.h>
+#include "piReference.h"
+
+// Two decimals per byte as packed BCD, so the hex dump reads like pi.
+// 2 KB of flash; generated with Machin's formula on big integers.
+static const uint8_t piReferenceBcd[PI_REFERENCE_DIGITS / 2] PROGMEM = {
+	0x14, 0x15, 0x92, 0x65, 0x35, 0x89, 0x79, 0x32, 0x38, 0x46, 0x26, 0x43, 0x38, 0x32, 0x79, 0x50,
+	0x28, 0x84, 0x19, 0x71, 0x69, 0x39, 0x93, 0x75, 0x10, 0x58, 0x20, 0x97, 0x49, 0x44, 0x59, 0x23,
+	0x07, 0x81, 0x64, 0x06, 0x28, 0x62, 0x08, 0x99, 0x86, 0x28, 0x03, 0x48, 0x25, 0x34, 0x21, 0x17,
+	0x06, 0x79, 0x82, 0x14, 0x80, 0x86, 0x51, 0x32, 0x82, 0x30, 0x66, 0x47, 0x09, 0x38, 0x44, 0x60,
+	0x95, 0x50, 0x58, 0x22, 0x31, 0x72, 0x53, 0x59, 0x40, 0x81, 0x28, 0x48, 0x11, 0x17, 0x45, 0x02,
+	0x84, 0x10, 0x27, 0x01, 0x93, 0x85, 0x21, 0x10, 0x55, 0x59, 0x64, 0x46, 0x22, 0x94, 0x89, 0x54,
+	0x93, 0x03, 0x81, 0x96, 0x44, 0x28, 0x81, 0x09, 0x75, 0x66, 0x59, 0x33, 0x44, 0x61, 0x28, 0x47,
+	0x56, 0x48, 0x23, 0x37, 0x86, 0x78, 0x31, 0x65, 0x27, 0x12, 0x01, 0x90, 0x91, 0x45, 0x64, 0x85,
+	0x66, 0x92, 0x34, 0x60, 0x34, 0x86, 0x10, 0x45, 0x43, 0x26, 0x64, 0x82, 0x13, 0x39, 0x36, 0x07,
+	0x26, 0x02, 0x49, 0x14, 0x12, 0x73, 0x72, 0x45, 0x87, 0x00, 0x66, 0x06, 0x31, 0x55, 0x88, 0x17,
+	0x48, 0x81, 0x52, 0x09, 0x20, 0x96, 0x28, 0x29, 0x25, 0x40, 0x91, 0x71, 0x53, 0x64, 0x36, 0x78,
+	0x92, 0x59, 0x03, 0x60, 0x01, 0x13, 0x30, 0x53, 0x05, 0x48, 0x82, 0x04, 0x66, 0x52, 0x13, 0x84,
+	0x14, 0x69, 0x51, 0x94, 0x15, 0x11, 0x60, 0x94, 0x33, 0x05, 0x72, 0x70, 0x36, 0x57, 0x59, 0x59,
+	0x19, 0x53, 0x09, 0x21, 0x86, 0x11, 0x73, 0x81, 0x93, 0x26, 0x11, 0x79, 0x31, 0x05, 0x11, 0x85,
+	0x48, 0x07, 0x44, 0x62, 0x37, 0x99, 0x62, 0x74, 0x95, 0x67, 0x35, 0x18, 0x85, 0x75, 0x27, 0x24,
+	0x89, 0x12, 0x27, 0x93, 0x81, 0x83, 0x01, 0x19, 0x49, 0x12, 0x98, 0x33, 0x67, 0x33, 0x62, 0x44,
+	0x06, 0x56, 0x64, 0x30, 0x86, 0x02, 0x13, 0x94, 0x94, 0x63, 0x95, 0x22, 0x47, 0x37, 0x19, 0x07,
+	0x02, 0x17, 0x98, 0x60, 0x94, 0x37, 0x02, 0x77, 0x05, 0x39, 0x21, 0x71, 0x76, 0x29, 0x31, 0x76,
+	0x75, 0x23, 0x84, 0x67, 0x48, 0x18, 0x46, 0x76, 0x69, 0x40, 0x51, 0x32, 0x00, 0x05, 0x68, 0x12,
+	0x71, 0x45, 0x26, 0x35, 0x60, 0x82, 0x77, 0x85, 0x77, 0x13, 0x42, 0x75, 0x77, 0x89, 0x60, 0x91,
+	0x73, 0x63, 0x71, 0x78, 0x72, 0x14, 0x68, 0x44, 0x09, 0x01, 0x22, 0x49, 0x53, 0x43, 0x01, 0x46,
+	0x54, 0x95, 0x85, 0x37, 0x10, 0x50, 0x79, 0x22, 0x79, 0x68, 0x92, 0x58, 0x92, 0x35, 0x42, 0x01,
+	0x99, 0x56, 0x11, 0x21, 0x29, 0x02, 0x19, 0x60, 0x86, 0x40, 0x34, 0x41, 0x81, 0x59, 0x81, 0x36,
+	0x29, 0x77, 0x47, 0x71, 0x30, 0x99, 0x60, 0x51, 0x87, 0x07, 0x21, 0x13, 0x49, 0x99, 0x99, 0x98,
+	0x37, 0x29, 0x78, 0x04, 0x99, 0x51, 0x05, 0x97, 0x31, 0x73, 0x28, 0x16, 0x09, 0x63, 0x18, 0x59,
+	0x50, 0x24, 0x45, 0x94, 0x55, 0x34, 0x69, 0x08, 0x30, 0x26, 0x42, 0x52, 0x23, 0x08, 0x25, 0x33,
+	0x44, 0x68, 0x50, 0x35, 0x26, 0x19, 0x31, 0x18, 0x81, 0x71, 0x01, 0x00, 0x03, 0x13, 0x78, 0x38,
+	0x75, 0x28, 0x86, 0x58, 0x75, 0x33, 0x20, 0x83, 0x81, 0x42, 0x06, 0x17, 0x17, 0x76, 0x69, 0x14,
+	0x73, 0x03, 0x59, 0x82, 0x53, 0x49, 0x04, 0x28, 0x75, 0x54, 0x68, 0x73, 0x11, 0x59, 0x56, 0x28,
+	0x63, 0x88, 0x23, 0x53, 0x78, 0x75, 0x93, 0x75, 0x19, 0x57, 0x78, 0x18, 0x57, 0x78, 0x05, 0x32,
+	0x17, 0x12, 0x26, 0x80, 0x66, 0x13, 0x00, 0x19, 0x27, 0x87, 0x66, 0x11, 0x19, 0x59, 0x09, 0x21,
+	0x64, 0x20, 0x19, 0x89, 0x38, 0x09, 0x52, 0x57, 0x20, 0x10, 0x65, 0x48, 0x58, 0x63, 0x27, 0x88,
+	0x65, 0x93, 0x61, 0x53, 0x38, 0x18, 0x27, 0x96, 0x82, 0x30, 0x30, 0x19, 0x52, 0x03, 0x53, 0x01,
+	0x85, 0x29, 0x68, 0x99, 0x57, 0x73, 0x62, 0x25, 0x99, 0x41, 0x38, 0x91, 0x24, 0x97, 0x21, 0x77,
+	0x52, 0x83, 0x47, 0x91, 0x31, 0x51, 0x55, 0x74, 0x85, 0x72, 0x42, 0x45, 0x41, 0x50, 0x69, 0x59,
+	0x50, 0x82, 0x95, 0x33, 0x11, 0x68, 0x61, 0x72, 0x78, 0x55, 0x88, 0x90, 0x75, 0x09, 0x83, 0x81,
+	0x75, 0x46, 0x37, 0x46, 0x49, 0x39, 0x31, 0x92, 0x55, 0x06, 0x04, 0x00, 0x92, 0x77, 0x01, 0x67,
+	0x11, 0x39, 0x00, 0x98, 0x48, 0x82, 0x40, 0x12, 0x85, 0x83, 0x61, 0x60, 0x35, 0x63, 0x70, 0x76,
+	0x60, 0x10, 0x47, 0x10, 0x18, 0x19, 0x42, 0x95, 0x55, 0x96, 0x19, 0x89, 0x46, 0x76, 0x78, 0x37,
+	0x44, 0x94, 0x48, 0x25, 0x53, 0x79, 0x77, 0x47, 0x26, 0x84, 0x71, 0x04, 0x04, 0x75, 0x34, 0x64,
+	0x62, 0x08, 0x04, 0x66, 0x84, 0x25, 0x90, 0x69, 0x49, 0x12, 0x93, 0x31, 0x36, 0x77, 0x02, 0x89,
+	0x89, 0x15, 0x21, 0x04, 0x75, 0x21, 0x62, 0x05, 0x69, 0x66, 0x02, 0x40, 0x58, 0x03, 0x81, 0x50,
+	0x19, 0x35, 0x11, 0x25, 0x33, 0x82, 0x43, 0x00, 0x35, 0x58, 0x76, 0x40, 0x24, 0x74, 0x96, 0x47,
+	0x32, 0x63, 0x91, 0x41, 0x99, 0x27, 0x26, 0x04, 0x26, 0x99, 0x22, 0x79, 0x67, 0x82, 0x35, 0x47,
+	0x81, 0x63, 0x60, 0x09, 0x34, 0x17, 0x21, 0x64, 0x12, 0x19, 0x92, 0x45, 0x86, 0x31, 0x50, 0x30,
+	0x28, 0x61, 0x82, 0x97, 0x45, 0x55, 0x70, 0x67, 0x49, 0x83, 0x85, 0x05, 0x49, 0x45, 0x88, 0x58,
+	0x69, 0x26, 0x99, 0x56, 0x90, 0x92, 0x72, 0x10, 0x79, 0x75, 0x09, 0x30, 0x29, 0x55, 0x32, 0x11,
+	0x65, 0x34, 0x49, 0x87, 0x20, 0x27, 0x55, 0x96, 0x02, 0x36, 0x48, 0x06, 0x65, 0x49, 0x91, 0x19,
+	0x88, 0x18, 0x34, 0x79, 0x77, 0x53, 0x56, 0x63, 0x69, 0x80, 0x74, 0x26, 0x54, 0x25, 0x27, 0x86,
+	0x25, 0x51, 0x81, 0x84, 0x17, 0x57, 0x46, 0x72, 0x89, 0x09, 0x77, 0x77, 0x27, 0x93, 0x80, 0x00,
+	0x81, 0x64, 0x70, 0x60, 0x01, 0x61, 0x45, 0x24, 0x91, 0x92, 0x17, 0x32, 0x17, 0x21, 0x47, 0x72,
+	0x35, 0x01, 0x41, 0x44, 0x19, 0x73, 0x56, 0x85, 0x48, 0x16, 0x13, 0x61, 0x15, 0x73, 0x52, 0x55,
+	0x21, 0x33, 0x47, 0x57, 0x41, 0x84, 0x94, 0x68, 0x43, 0x85, 0x23, 0x32, 0x39, 0x07, 0x39, 0x41,
+	0x43, 0x33, 0x45, 0x47, 0x76, 0x24, 0x16, 0x86, 0x25, 0x18, 0x98, 0x35, 0x69, 0x48, 0x55, 0x62,
+	0x09, 0x92, 0x19, 0x22, 0x21, 0x84, 0x27, 0x25, 0x50, 0x25, 0x42, 0x56, 0x88, 0x76, 0x71, 0x79,
+	0x04, 0x94, 0x60, 0x16, 0x53, 0x46, 0x68, 0x04, 0x98, 0x86, 0x27, 0x23, 0x27, 0x91, 0x78, 0x60,
+	0x85, 0x78, 0x43, 0x83, 0x82, 0x79, 0x67, 0x97, 0x66, 0x81, 0x45, 0x41, 0x00, 0x95, 0x38, 0x83,
+	0x78, 0x63, 0x60, 0x95, 0x06, 0x80, 0x06, 0x42, 0x25, 0x12, 0x52, 0x05, 0x11, 0x73, 0x92, 0x98,
+	0x48, 0x96, 0x08, 0x41, 0x28, 0x48, 0x86, 0x26, 0x94, 0x56, 0x04, 0x24, 0x19, 0x65, 0x28, 0x50,
+	0x22, 0x21, 0x06, 0x61, 0x18, 0x63, 0x06, 0x74, 0x42, 0x78, 0x62, 0x20, 0x39, 0x19, 0x49, 0x45,
+	0x04, 0x71, 0x23, 0x71, 0x37, 0x86, 0x96, 0x09, 0x56, 0x36, 0x43, 0x71, 0x91, 0x72, 0x87, 0x46,
+	0x77, 0x64, 0x65, 0x75, 0x73, 0x96, 0x24, 0x13, 0x89, 0x08, 0x65, 0x83, 0x26, 0x45, 0x99, 0x58,
+	0x13, 0x39, 0x04, 0x78, 0x02, 0x75, 0x90, 0x09, 0x94, 0x65, 0x76, 0x40, 0x78, 0x95, 0x12, 0x69,
+	0x46, 0x83, 0x98, 0x35, 0x25, 0x95, 0x70, 0x98, 0x25, 0x82, 0x26, 0x20, 0x52, 0x24, 0x89, 0x40,
+	0x77, 0x26, 0x71, 0x94, 0x78, 0x26, 0x84, 0x82, 0x60, 0x14, 0x76, 0x99, 0x09, 0x02, 0x64, 0x01,
+	0x36, 0x39, 0x44, 0x37, 0x45, 0x53, 0x05, 0x06, 0x82, 0x03, 0x49, 0x62, 0x52, 0x45, 0x17, 0x49,
+	0x39, 0x96, 0x51, 0x43, 0x14, 0x29, 0x80, 0x91, 0x90, 0x65, 0x92, 0x50, 0x93, 0x72, 0x21, 0x69,
+	0x64, 0x61, 0x51, 0x57, 0x09, 0x85, 0x83, 0x87, 0x41, 0x05, 0x97, 0x88, 0x59, 0x59, 0x77, 0x29,
+	0x75, 0x49, 0x89, 0x30, 0x16, 0x17, 0x53, 0x92, 0x84, 0x68, 0x13, 0x82, 0x68, 0x68, 0x38, 0x68,
+	0x94, 0x27, 0x74, 0x15, 0x59, 0x91, 0x85, 0x59, 0x25, 0x24, 0x59, 0x53, 0x95, 0x94, 0x31, 0x04,
+	0x99, 0x72, 0x52, 0x46, 0x80, 0x84, 0x59, 0x87, 0x27, 0x36, 0x44, 0x69, 0x58, 0x48, 0x65, 0x38,
+	0x36, 0x73, 0x62, 0x22, 0x62, 0x60, 0x99, 0x12, 0x46, 0x08, 0x05, 0x12, 0x43, 0x88, 0x43, 0x90,
+	0x45, 0x12, 0x44, 0x13, 0x65, 0x49, 0x76, 0x27, 0x80, 0x79, 0x77, 0x15, 0x69, 0x14, 0x35, 0x99,
+	0x77, 0x00, 0x12, 0x96, 0x16, 0x08, 0x94, 0x41, 0x69, 0x48, 0x68, 0x55, 0x58, 0x48, 0x40, 0x63,
+	0x53, 0x42, 0x20, 0x72, 0x22, 0x58, 0x28, 0x48, 0x86, 0x48, 0x15, 0x84, 0x56, 0x02, 0x85, 0x06,
+	0x01, 0x68, 0x42, 0x73, 0x94, 0x52, 0x26, 0x74, 0x67, 0x67, 0x88, 0x95, 0x25, 0x21, 0x38, 0x52,
+	0x25, 0x49, 0x95, 0x46, 0x66, 0x72, 0x78, 0x23, 0x98, 0x64, 0x56, 0x59, 0x61, 0x16, 0x35, 0x48,
+	0x86, 0x23, 0x05, 0x77, 0x45, 0x64, 0x98, 0x03, 0x55, 0x93, 0x63, 0x45, 0x68, 0x17, 0x43, 0x24,
+	0x11, 0x25, 0x15, 0x07, 0x60, 0x69, 0x47, 0x94, 0x51, 0x09, 0x65, 0x96, 0x09, 0x40, 0x25, 0x22,
+	0x88, 0x79, 0x71, 0x08, 0x93, 0x14, 0x56, 0x69, 0x13, 0x68, 0x67, 0x22, 0x87, 0x48, 0x94, 0x05,
+	0x60, 0x10, 0x15, 0x03, 0x30, 0x86, 0x17, 0x92, 0x86, 0x80, 0x92, 0x08, 0x74, 0x76, 0x09, 0x17,
+	0x82, 0x49, 0x38, 0x58, 0x90, 0x09, 0x71, 0x49, 0x09, 0x67, 0x59, 0x85, 0x26, 0x13, 0x65, 0x54,
+	0x97, 0x81, 0x89, 0x31, 0x29, 0x78, 0x48, 0x21, 0x68, 0x29, 0x98, 0x94, 0x87, 0x22, 0x65, 0x88,
+	0x04, 0x85, 0x75, 0x64, 0x01, 0x42, 0x70, 0x47, 0x75, 0x55, 0x13, 0x23, 0x79, 0x64, 0x14, 0x51,
+	0x52, 0x37, 0x46, 0x23, 0x43, 0x64, 0x54, 0x28, 0x58, 0x44, 0x47, 0x95, 0x26, 0x58, 0x67, 0x82,
+	0x10, 0x51, 0x14, 0x13, 0x54, 0x73, 0x57, 0x39, 0x52, 0x31, 0x13, 0x42, 0x71, 0x66, 0x10, 0x21,
+	0x35, 0x96, 0x95, 0x36, 0x23, 0x14, 0x42, 0x95, 0x24, 0x84, 0x93, 0x71, 0x87, 0x11, 0x01, 0x45,
+	0x76, 0x54, 0x03, 0x59, 0x02, 0x79, 0x93, 0x44, 0x03, 0x74, 0x20, 0x07, 0x31, 0x05, 0x78, 0x53,
+	0x90, 0x62, 0x19, 0x83, 0x87, 0x44, 0x78, 0x08, 0x47, 0x84, 0x89, 0x68, 0x33, 0x21, 0x44, 0x57,
+	0x13, 0x86, 0x87, 0x51, 0x94, 0x35, 0x06, 0x43, 0x02, 0x18, 0x45, 0x31, 0x91, 0x04, 0x84, 0x81,
+	0x00, 0x53, 0x70, 0x61, 0x46, 0x80, 0x67, 0x49, 0x19, 0x27, 0x81, 0x91, 0x19, 0x79, 0x39, 0x95,
+	0x20, 0x61, 0x41, 0x96, 0x63, 0x42, 0x87, 0x54, 0x44, 0x06, 0x43, 0x74, 0x51, 0x23, 0x71, 0x81,
+	0x92, 0x17, 0x99, 0x98, 0x39, 0x10, 0x15, 0x91, 0x95, 0x61, 0x81, 0x46, 0x75, 0x14, 0x26, 0x91,
+	0x23, 0x97, 0x48, 0x94, 0x09, 0x07, 0x18, 0x64, 0x94, 0x23, 0x19, 0x61, 0x56, 0x79, 0x45, 0x20,
+	0x80, 0x95, 0x14, 0x65, 0x50, 0x22, 0x52, 0x31, 0x60, 0x38, 0x81, 0x93, 0x01, 0x42, 0x09, 0x37,
+	0x62, 0x13, 0x78, 0x55, 0x95, 0x66, 0x38, 0x93, 0x77, 0x87, 0x08, 0x30, 0x39, 0x06, 0x97, 0x92,
+	0x07, 0x73, 0x46, 0x72, 0x21, 0x82, 0x56, 0x25, 0x99, 0x66, 0x15, 0x01, 0x42, 0x15, 0x03, 0x06,
+	0x80, 0x38, 0x44, 0x77, 0x34, 0x54, 0x92, 0x02, 0x60, 0x54, 0x14, 0x66, 0x59, 0x25, 0x20, 0x14,
+	0x97, 0x44, 0x28, 0x50, 0x73, 0x25, 0x18, 0x66, 0x60, 0x02, 0x13, 0x24, 0x34, 0x08, 0x81, 0x90,
+	0x71, 0x04, 0x86, 0x33, 0x17, 0x34, 0x64, 0x96, 0x51, 0x45, 0x39, 0x05, 0x79, 0x62, 0x68, 0x56,
+	0x10, 0x05, 0x50, 0x81, 0x06, 0x65, 0x87, 0x96, 0x99, 0x81, 0x63, 0x57, 0x47, 0x36, 0x38, 0x40,
+	0x52, 0x57, 0x14, 0x59, 0x10, 0x28, 0x97, 0x06, 0x41, 0x40, 0x11, 0x09, 0x71, 0x20, 0x62, 0x80,
+	0x43, 0x90, 0x39, 0x75, 0x95, 0x15, 0x67, 0x71, 0x57, 0x70, 0x04, 0x20, 0x33, 0x78, 0x69, 0x93,
+	0x60, 0x07, 0x23, 0x05, 0x58, 0x76, 0x31, 0x76, 0x35, 0x94, 0x21, 0x87, 0x31, 0x25, 0x14, 0x71,
+	0x20, 0x53, 0x29, 0x28, 0x19, 0x18, 0x26, 0x18, 0x61, 0x25, 0x86, 0x73, 0x21, 0x57, 0x91, 0x98,
+	0x41, 0x48, 0x48, 0x82, 0x91, 0x64, 0x47, 0x06, 0x09, 0x57, 0x52, 0x70, 0x69, 0x57, 0x22, 0x09,
+	0x17, 0x56, 0x71, 0x16, 0x72, 0x29, 0x10, 0x98, 0x16, 0x90, 0x91, 0x52, 0x80, 0x17, 0x35, 0x06,
+	0x71, 0x27, 0x48, 0x58, 0x32, 0x22, 0x87, 0x18, 0x35, 0x20, 0x93, 0x53, 0x96, 0x57, 0x25, 0x12,
+	0x10, 0x83, 0x57, 0x91, 0x51, 0x36, 0x98, 0x82, 0x09, 0x14, 0x44, 0x21, 0x00, 0x67, 0x51, 0x03,
+	0x34, 0x67, 0x11, 0x03, 0x14, 0x12, 0x67, 0x11, 0x13, 0x69, 0x90, 0x86, 0x58, 0x51, 0x63, 0x98,
+	0x31, 0x50, 0x19, 0x70, 0x16, 0x51, 0x51, 0x16, 0x85, 0x17, 0x14, 0x37, 0x65, 0x76, 0x18, 0x35,
+	0x15, 0x56, 0x50, 0x88, 0x49, 0x09, 0x98, 0x98, 0x59, 0x98, 0x23, 0x87, 0x34, 0x55, 0x28, 0x33,
+	0x16, 0x35, 0x50, 0x76, 0x47, 0x91, 0x85, 0x35, 0x89, 0x32, 0x26, 0x18, 0x54, 0x89, 0x63, 0x21,
+	0x32, 0x93, 0x30, 0x89, 0x85, 0x70, 0x64, 0x20, 0x46, 0x75, 0x25, 0x90, 0x70, 0x91, 0x54, 0x81,
+	0x41, 0x65, 0x49, 0x85, 0x94, 0x61, 0x63, 0x71, 0x80, 0x27, 0x09, 0x81, 0x99, 0x43, 0x09, 0x92,
+	0x44, 0x88, 0x95, 0x75, 0x71, 0x28, 0x28, 0x90, 0x59, 0x23, 0x23, 0x32, 0x60, 0x97, 0x29, 0x97,
+	0x12, 0x08, 0x44, 0x33, 0x57, 0x32, 0x65, 0x48, 0x93, 0x82, 0x39, 0x11, 0x93, 0x25, 0x97, 0x46,
+	0x36, 0x67, 0x30, 0x58, 0x36, 0x04, 0x14, 0x28, 0x13, 0x88, 0x30, 0x32, 0x03, 0x82, 0x49, 0x03,
+	0x75, 0x89, 0x85, 0x24, 0x37, 0x44, 0x17, 0x02, 0x91, 0x32, 0x76, 0x56, 0x18, 0x09, 0x37, 0x73,
+	0x44, 0x40, 0x30, 0x70, 0x74, 0x69, 0x21, 0x12, 0x01, 0x91, 0x30, 0x20, 0x33, 0x03, 0x80, 0x19,
+	0x76, 0x21, 0x10, 0x11, 0x00, 0x44, 0x92, 0x93, 0x21, 0x51, 0x60, 0x84, 0x24, 0x44, 0x85, 0x96,
+	0x37, 0x66, 0x98, 0x38, 0x95, 0x22, 0x86, 0x84, 0x78, 0x31, 0x23, 0x55, 0x26, 0x58, 0x21, 0x31,
+	0x44, 0x95, 0x76, 0x85, 0x72, 0x62, 0x43, 0x34, 0x41, 0x89, 0x30, 0x39, 0x68, 0x64, 0x26, 0x24,
+	0x34, 0x10, 0x77, 0x32, 0x26, 0x97, 0x80, 0x28, 0x07, 0x31, 0x89, 0x15, 0x44, 0x11, 0x01, 0x04,
+	0x46, 0x82, 0x32, 0x52, 0x71, 0x62, 0x01, 0x05, 0x26, 0x52, 0x27, 0x21, 0x11, 0x66, 0x03, 0x96,
+	0x66, 0x55, 0x73, 0x09, 0x25, 0x47, 0x11, 0x05, 0x57, 0x85, 0x37, 0x63, 0x46, 0x68, 0x20, 0x65,
+	0x31, 0x09, 0x89, 0x65, 0x26, 0x91, 0x86, 0x20, 0x56, 0x47, 0x69, 0x31, 0x25, 0x70, 0x58, 0x63,
+	0x56, 0x62, 0x01, 0x85, 0x58, 0x10, 0x07, 0x29, 0x36, 0x06, 0x59, 0x87, 0x64, 0x86, 0x11, 0x79,
+};
+
+uint8_t piReferenceDigit(uint16_t index)
+{
+	uint8_t pair = pgm_read_byte_far(pgm_get_far_address(piReferenceBcd) + index / 2);
+	return (index & 1) ? (pair & 0x0F) : (pair >> 4);
+}
+
+void piVerifyInit(piVerify_t *verify)
+{
+	verify->verified = 0;
+	verify->checked = 0;
+}
+
+uint16_t piVerifyDigit(piVerify_t *verify, uint16_t index, char digit)
+{
+	if (index == verify->verified && index < PI_REFERENCE_DIGITS && digit - '0' == piReferenceDigit(index)) {
+		verify->verified++;
+	}
+	return verify->verified;
+}
+
+uint16_t piVerifyMultiword(piVerify_t *verify, const mword_t *a, uint16_t n, uint16_t count, mword_t *scratch)
+{
+	if (count > PI_REFERENCE_DIGITS) {
+		count = PI_REFERENCE_DIGITS;
+	}
+	if (count <= verify->checked || a[0] != 3) {
+		return verify->verified;
+	}
+	verify->checked = count;
+
+	// Four decimals per pass: the integer word of frac * 10000, as in mwFormat()
+	mwCopy(scratch, a, n);
+	for (uint16_t index = 0; index < count; index += 4) {
+		scratch[0] = 0;
+		mwMulSmall(scratch, n, 10000);
+		if (index + 4 <= verify->verified) {
+			continue;
+		}
+		uint16_t group = scratch[0];
+		uint16_t divisor = 1000;
+		for (uint16_t i = index; i < index + 4 && i < count; i++) {
+			if (i >= verify->verified) {
+				if ((group / divisor) % 10 != piReferenceDigit(i)) {
+					return verify->verified;
+				}
+				verify->verified++;
+			}
+			divisor /= 10;
+		}
+	}
+	return verify->verified;
+}
@@ -0,0 +1,102 @@
+/*
+ * piSpigot.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "piCalcConfig.h"
+#include "piSpigot.h"
+
+// Extra digits of array kept beyond the digits still to come; with fewer
+// guard digits the last digits of a run come out wrong
+#define SPIGOT_GUARD_DIGITS	4
+
+void spigotInit(spigotState_t *state, uint16_t *remainders, uint16_t length)
+{
+	state->remainders = remainders;
+	state->length = length;
+	state->digitsTotal = SPIGOT_DIGITS_FOR_LENGTH(length);
+	state->digitsComputed = 0;
+	state->digitsEmitted = 0;
+	state->nines = 0;
+	state->predigit = -1;
+
+	// pi = 2 + 1/3*(2 + 2/5*(2 + 3/7*(2 + ...)))
+	for (uint16_t i = 0; i < length; i++) {
+		remainders[i] = 2;
+	}
+}
+
+uint16_t spigotPassRef(uint16_t *remainders, uint16_t active)
+{
+	uint32_t carry = 0;
+
+	for (uint16_t i = active; i > 0; i--) {
+		uint32_t x = 10UL * remainders[i - 1] + carry * i;
+		uint16_t denominator = 2 * i - 1;
+		remainders[i - 1] = x % denominator;
+		carry = x / denominator;
+	}
+	return (uint16_t)carry;
+}
+
+#if (PI_MULTIWORD_ASM == 0)
+
+uint16_t spigotPass(uint16_t *remainders, uint16_t active)
+{
+	return spigotPassRef(remainders, active);
+}
+
+#endif
+
+static void emitDigit(spigotState_t *state, spigotEmit_t emit, char digit)
+{
+	emit(digit);
+	state->digitsEmitted++;
+}
+
+static void releaseHeldDigits(spigotState_t *state, spigotEmit_t emit, uint8_t carry)
+{
+	if (state->predigit >= 0) {
+		emitDigit(state, emit, '0' + state->predigit + carry);
+	}
+	for (; state->nines > 0; state->nines--) {
+		emitDigit(state, emit, carry ? '0' : '9');
+	}
+}
+
+bool spigotStep(spigotState_t *state, spigotEmit_t emit)
+{
+	if (state->digitsComputed >= state->digitsTotal) {
+		if (state->predigit >= 0) {
+			releaseHeldDigits(state, emit, 0);
+			state->predigit = -1;
+		}
+		return false;
+	}
+
+	// Digits still to come only need the leading part of the array,
+	// which halves the total work of a run
+	uint16_t active = SPIGOT_LENGTH_FOR_DIGITS(state->digitsTotal - state->digitsComputed + SPIGOT_GUARD_DIGITS);
+	if (active > state->length) {
+		active = state->length;
+	}
+
+	uint16_t *remainders = state->remainders;
+	uint16_t carry = spigotPass(remainders, active);
+	uint8_t digit = carry % 10;
+	remainders[0] = digit;
+	carry /= 10;
+	state->digitsComputed++;
+
+	if (carry == 9) {
+		state->nines++;
+	} else if (carry == 10) {
+		releaseHeldDigits(state, emit, 1);
+		state->predigit = 0;
+	} else {
+		releaseHeldDigits(state, emit, 0);
+		state->predigit = carry;
+	}
+	return true;
+}
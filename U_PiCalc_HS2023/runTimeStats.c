@@ -0,0 +1,87 @@
+/*
+ * runTimeStats.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include "avr_compiler.h"
+#include "TC_driver.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "runTimeStats.h"
+
+#if (configGENERATE_RUN_TIME_STATS == 1)
+
+// Upper half of the counter, one step per TCD0 overflow (131 ms)
+static volatile uint16_t runTimeHigh;
+
+// Kernel view of the tasks and the counters of the previous sample, by task number
+static TaskStatus_t taskStatus[RUNTIME_STATS_MAX_TASKS];
+static uint32_t previousTime[RUNTIME_STATS_MAX_TASKS];
+static runTimeStats_t stats;
+
+ISR(TCD0_OVF_vect) {
+	runTimeHigh++;
+}
+
+void vRunTimeStatsInit(void)
+{
+	TC_SetPeriod(&TCD0, 0xFFFF);
+	TC0_ConfigWGM(&TCD0, TC_WGMODE_NORMAL_gc);
+	TC0_SetOverflowIntLevel(&TCD0, TC_OVFINTLVL_LO_gc);
+	TC0_ConfigClockSource(&TCD0, TC_CLKSEL_DIV64_gc);
+}
+
+uint32_t ulRunTimeStatsCounter(void)
+{
+	AVR_ENTER_CRITICAL_REGION();
+	uint16_t low = TCD0.CNT;
+	uint16_t high = runTimeHigh;
+	// An overflow that happened before the read but is not counted yet
+	if (TC_GetOverflowFlag(&TCD0) && low < 0x8000) {
+		high++;
+	}
+	AVR_LEAVE_CRITICAL_REGION();
+	return ((uint32_t)high << 16) | low;
+}
+
+const runTimeStats_t *pxRunTimeStatsSample(void)
+{
+	uint32_t delta[RUNTIME_STATS_MAX_TASKS];
+	uint32_t interval = 0;
+	UBaseType_t count = uxTaskGetSystemState(taskStatus, RUNTIME_STATS_MAX_TASKS, NULL);
+
+	// The kernel lists the tasks by state, sort them into creation order
+	for (uint8_t i = 1; i < count; i++)
+	{
+		TaskStatus_t task = taskStatus[i];
+		uint8_t j = i;
+		while (j > 0 && taskStatus[j - 1].xTaskNumber > task.xTaskNumber)
+		{
+			taskStatus[j] = taskStatus[j - 1];
+			j--;
+		}
+		taskStatus[j] = task;
+	}
+
+	stats.count = count;
+	stats.total = 0;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		uint8_t slot = (taskStatus[i].xTaskNumber - 1) % RUNTIME_STATS_MAX_TASKS;
+		uint32_t time = taskStatus[i].ulRunTimeCounter;
+		delta[i] = time - previousTime[slot];
+		previousTime[slot] = time;
+		interval += delta[i];
+		stats.total += time;
+		stats.tasks[i].name = taskStatus[i].pcTaskName;
+		stats.tasks[i].time = time;
+	}
+	// The shares of all tasks add up to the interval, not to the wall clock
+	for (uint8_t i = 0; i < count; i++) {
+		stats.tasks[i].percent = (interval > 0) ? (uint8_t)(100.0f * delta[i] / interval + 0.5f) : 0;
+	}
+	return &stats;
+}
+
+#endif
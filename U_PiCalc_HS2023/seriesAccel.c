@@ -0,0 +1,40 @@
+/*
+ * seriesAccel.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <math.h>
+#include "seriesAccel.h"
+
+float accelAitken(seriesTerm_t term, uint32_t n)
+{
+	if (n < 2) {
+		return 0.0f;
+	}
+	float last = term(n - 1);
+	float denominator = last - term(n - 2);
+
+	return (denominator != 0.0f) ? -(last * last) / denominator : 0.0f;
+}
+
+float accelEuler(seriesTerm_t term, uint32_t n)
+{
+	// Partial sums S_(n-depth) .. S_n, relative to S_n so float keeps their
+	// differences: offset[i] = S_(n-depth+i) - S_n
+	float offset[ACCEL_EULER_TERMS + 1];
+	uint8_t depth = (n < ACCEL_EULER_TERMS) ? (uint8_t)n : ACCEL_EULER_TERMS;
+
+	offset[depth] = 0.0f;
+	for (uint8_t i = depth; i > 0; i--) {
+		offset[i - 1] = offset[i] - term(n - depth + i - 1);
+	}
+
+	// Each pass averages neighbouring sums, which cancels the alternating error
+	for (uint8_t pass = 0; pass < depth; pass++) {
+		for (uint8_t i = 0; i < depth - pass; i++) {
+			offset[i] = 0.5f * (offset[i] + offset[i + 1]);
+		}
+	}
+	return offset[0];
+}
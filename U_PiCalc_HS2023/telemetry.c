@@ -0,0 +1,52 @@
+/*
+ * telemetry.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "avr_compiler.h"
+#include "telemetry.h"
+
+#if (PI_TELEMETRY == 1)
+
+#define TELEMETRY_LINE_LENGTH 64
+
+static char telemetryLine[TELEMETRY_LINE_LENGTH];
+
+void vTelemetryInit(void)
+{
+	PI_TELEMETRY_PORT.OUTSET = PI_TELEMETRY_TX_PIN;	// idle high before the pin becomes an output
+	PI_TELEMETRY_PORT.DIRSET = PI_TELEMETRY_TX_PIN;
+
+	// 115200 baud at 32 MHz: BSEL 2094, BSCALE -7 (4-bit two's complement 0x9), 0.01 % error
+	PI_TELEMETRY_USART.BAUDCTRLA = (uint8_t)2094;
+	PI_TELEMETRY_USART.BAUDCTRLB = (uint8_t)(0x9 << USART_BSCALE_gp) | (uint8_t)(2094 >> 8);
+	PI_TELEMETRY_USART.CTRLC = USART_CMODE_ASYNCHRONOUS_gc | USART_PMODE_DISABLED_gc | USART_CHSIZE_8BIT_gc;
+	PI_TELEMETRY_USART.CTRLB = USART_TXEN_bm;
+}
+
+static void vTelemetryPutChar(char c)
+{
+	while (!(PI_TELEMETRY_USART.STATUS & USART_DREIF_bm)) {
+	}
+	PI_TELEMETRY_USART.DATA = c;
+}
+
+void vTelemetryPrintf_P(const char *format, ...)
+{
+	va_list arguments;
+
+	va_start(arguments, format);
+	vsnprintf_P(telemetryLine, sizeof(telemetryLine), format, arguments);
+	va_end(arguments);
+
+	for (char *c = telemetryLine; *c != '\0'; c++) {
+		vTelemetryPutChar(*c);
+	}
+	vTelemetryPutChar('\r');
+	vTelemetryPutChar('\n');
+}
+
+#endif
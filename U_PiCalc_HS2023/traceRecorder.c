@@ -0,0 +1,92 @@
+/*
+ * traceRecorder.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <string.h>
+#include "avr_compiler.h"
+#include "FreeRTOS.h"
+#include "errorHandler.h"
+#include "telemetry.h"
+#include "runTimeStats.h"
+#include "traceRecorder.h"
+
+#if (PI_TRACE == 1)
+
+// Bytes per telemetry line of the dump, sent as hex
+#define TRACE_DUMP_BYTES 24
+
+static traceBuffer_t *trace = NULL;
+static volatile bool recording = false;
+static uint8_t queues = 0, eventGroups = 0;
+
+void vTraceInit(void)
+{
+	trace = pvPortMalloc(sizeof(traceBuffer_t) + PI_TRACE_EVENTS * sizeof(uint32_t));
+	if (trace == NULL) {
+		error(ERR_LOW_HEAP_SPACE);
+	}
+	memset(trace, 0, sizeof(traceBuffer_t));
+	memcpy(trace->magic, TRACE_MAGIC, sizeof(trace->magic));
+	trace->version = TRACE_VERSION;
+	trace->length = PI_TRACE_EVENTS;
+	trace->ticksPerMs = RUNTIME_STATS_TICKS_PER_MS;
+	recording = true;
+}
+
+void vTraceRecord(uint8_t type, uint8_t object)
+{
+	if (!recording) {
+		return;
+	}
+	AVR_ENTER_CRITICAL_REGION();
+	uint32_t time = ulRunTimeStatsCounter() & 0x00FFFFFFUL;
+	trace->ring[trace->next] = ((uint32_t)type << 28) | ((uint32_t)(object & 0x0F) << 24) | time;
+	if (++trace->next == trace->length) {
+		trace->next = 0;
+		trace->flags |= TRACE_WRAPPED;
+	}
+	AVR_LEAVE_CRITICAL_REGION();
+}
+
+void vTraceTaskCreated(uint8_t number, const char *name)
+{
+	if (trace != NULL && number >= 1 && number <= TRACE_TASKS) {
+		strncpy(trace->names[number - 1], name, TRACE_NAME_LENGTH);
+	}
+}
+
+// Queues and event groups are numbered in the order they are created
+uint8_t uxTraceQueueNumber(void)
+{
+	return ++queues;
+}
+
+uint8_t uxTraceEventGroupNumber(void)
+{
+	return ++eventGroups;
+}
+
+void vTraceDump(void)
+{
+	static const char hex[] = "0123456789abcdef";
+	const uint8_t *block = (const uint8_t *)trace;
+	uint16_t size = sizeof(traceBuffer_t) + trace->length * sizeof(uint32_t);
+	char line[2 * TRACE_DUMP_BYTES + 1];
+
+	recording = false;
+	for (uint16_t offset = 0; offset < size; offset += TRACE_DUMP_BYTES)
+	{
+		uint8_t count = (size - offset < TRACE_DUMP_BYTES) ? size - offset : TRACE_DUMP_BYTES;
+		for (uint8_t i = 0; i < count; i++) {
+			line[2 * i] = hex[block[offset + i] >> 4];
+			line[2 * i + 1] = hex[block[offset + i] & 0x0F];
+		}
+		line[2 * count] = '\0';
+		vTelemetryPrintf("trace,%u,%s", offset, line);
+	}
+	recording = true;
+}
+
+#endif
@@ -0,0 +1,592 @@
+/*
+ * bignum.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "bignum.h"
+
+// Below this many limbs the schoolbook product is faster
+#define KARATSUBA_THRESHOLD		32
+
+// From this length of the shorter operand on products use the NTT
+#define NTT_THRESHOLD			1500
+
+static size_t memoryInUse = 0;
+static size_t memoryPeak = 0;
+
+/*---------------------------------------------------------------------------------*/
+// Counting allocator: the block size is kept in front of every block
+/*---------------------------------------------------------------------------------*/
+static void *limbAlloc(size_t limbs)
+{
+	size_t bytes = limbs * sizeof(uint32_t);
+	size_t *block = malloc(sizeof(size_t) + bytes);
+
+	if (block == NULL) {
+		fprintf(stderr, "bignum: out of memory (%zu bytes)\n", bytes);
+		exit(EXIT_FAILURE);
+	}
+	*block = bytes;
+	memoryInUse += bytes;
+	if (memoryInUse > memoryPeak) {
+		memoryPeak = memoryInUse;
+	}
+	return block + 1;
+}
+
+static void limbFree(void *limbs)
+{
+	if (limbs != NULL) {
+		size_t *block = (size_t *)limbs - 1;
+		memoryInUse -= *block;
+		free(block);
+	}
+}
+
+size_t bnMemoryInUse(void)
+{
+	return memoryInUse;
+}
+
+size_t bnMemoryPeak(void)
+{
+	return memoryPeak;
+}
+
+void bnMemoryResetPeak(void)
+{
+	memoryPeak = memoryInUse;
+}
+
+/*---------------------------------------------------------------------------------*/
+// Magnitude kernels on raw limb arrays
+/*---------------------------------------------------------------------------------*/
+
+// r[0..n) += a[0..na), returns the carry out of r[n-1]; na <= n
+static uint32_t limbsAdd(uint32_t *r, size_t n, const uint32_t *a, size_t na)
+{
+	uint32_t carry = 0;
+	size_t i;
+
+	for (i = 0; i < na; i++) {
+		uint32_t x = r[i] + a[i] + carry;
+		carry = (x >= BN_RADIX);
+		r[i] = carry ? x - BN_RADIX : x;
+	}
+	for (; carry && i < n; i++) {
+		uint32_t x = r[i] + 1;
+		carry = (x >= BN_RADIX);
+		r[i] = carry ? 0 : x;
+	}
+	return carry;
+}
+
+// r[0..n) -= a[0..na), the result must not be negative; na <= n
+static void limbsSub(uint32_t *r, size_t n, const uint32_t *a, size_t na)
+{
+	uint32_t borrow = 0;
+	size_t i;
+
+	for (i = 0; i < na; i++) {
+		uint32_t sub = a[i] + borrow;
+		borrow = (r[i] < sub);
+		r[i] = borrow ? r[i] + BN_RADIX - sub : r[i] - sub;
+	}
+	for (; borrow && i < n; i++) {
+		borrow = (r[i] == 0);
+		r[i] = borrow ? BN_RADIX - 1 : r[i] - 1;
+	}
+}
+
+// r[0..na+nb) = a * b, schoolbook by columns. A product is below 10^18, so
+// 16 of them and the carry fit 64 bits; the column sum is only reduced
+// modulo the radix once per 16 products instead of once per product.
+static void mulSchoolbook(uint32_t *r, const uint32_t *a, size_t na, const uint32_t *b, size_t nb)
+{
+	uint64_t carry = 0;
+
+	for (size_t c = 0; c < na + nb - 1; c++) {
+		size_t first = (c >= nb) ? c - nb + 1 : 0;
+		size_t last = (c < na) ? c : na - 1;
+		uint64_t low = carry;
+		uint64_t high = 0;
+		uint8_t pending = 0;
+
+		for (size_t i = first; i <= last; i++) {
+			low += (uint64_t)a[i] * b[c - i];
+			if (++pending == 16) {
+				high += low / BN_RADIX;
+				low %= BN_RADIX;
+				pending = 0;
+			}
+		}
+		high += low / BN_RADIX;
+		r[c] = (uint32_t)(low % BN_RADIX);
+		carry = high;
+	}
+	r[na + nb - 1] = (uint32_t)carry;
+}
+
+// r[0..2n) = a[0..n) * b[0..n)
+static void mulKaratsuba(uint32_t *r, const uint32_t *a, const uint32_t *b, size_t n)
+{
+	if (n < KARATSUBA_THRESHOLD) {
+		mulSchoolbook(r, a, n, b, n);
+		return;
+	}
+
+	// a = a1 * R^h + a0, the sums a0 + a1 take one limb more than the high half
+	size_t h = n / 2;
+	size_t m = n - h + 1;
+	uint32_t *sumA = limbAlloc(4 * m);
+	uint32_t *sumB = sumA + m;
+	uint32_t *middle = sumA + 2 * m;
+
+	memset(sumA, 0, 2 * m * sizeof(uint32_t));
+	memcpy(sumA, a + h, (n - h) * sizeof(uint32_t));
+	limbsAdd(sumA, m, a, h);
+	memcpy(sumB, b + h, (n - h) * sizeof(uint32_t));
+	limbsAdd(sumB, m, b, h);
+
+	mulKaratsuba(r, a, b, h);
+	mulKaratsuba(r + 2 * h, a + h, b + h, n - h);
+	mulKaratsuba(middle, sumA, sumB, m);
+
+	// (a0 + a1)(b0 + b1) - a0 b0 - a1 b1 = a0 b1 + a1 b0
+	limbsSub(middle, 2 * m, r, 2 * h);
+	limbsSub(middle, 2 * m, r + 2 * h, 2 * (n - h));
+	size_t used = 2 * m;
+	while (used > 0 && middle[used - 1] == 0) {
+		used--;
+	}
+	limbsAdd(r + h, 2 * n - h, middle, used);
+
+	limbFree(sumA);
+}
+
+// r[0..na+nb) = a * b, na >= nb: the long operand is cut into nb-limb slices
+static void mulUnbalanced(uint32_t *r, const uint32_t *a, size_t na, const uint32_t *b, size_t nb)
+{
+	if (nb < KARATSUBA_THRESHOLD) {
+		mulSchoolbook(r, a, na, b, nb);
+		return;
+	}
+
+	uint32_t *slice = limbAlloc(3 * nb);
+	uint32_t *product = slice + nb;
+
+	memset(r, 0, (na + nb) * sizeof(uint32_t));
+	for (size_t offset = 0; offset < na; offset += nb) {
+		size_t count = (na - offset < nb) ? na - offset : nb;
+		memset(slice, 0, nb * sizeof(uint32_t));
+		memcpy(slice, a + offset, count * sizeof(uint32_t));
+		mulKaratsuba(product, slice, b, nb);
+		size_t used = count + nb;
+		limbsAdd(r + offset, na + nb - offset, product, used);
+	}
+	limbFree(slice);
+}
+
+/*---------------------------------------------------------------------------------*/
+// Number theoretic transform: the convolution of the limbs is computed modulo
+// three primes c * 2^k + 1 and recombined by the Chinese remainder theorem.
+// A column sum is below n * 10^18, the product of the primes is 1.6e26, so
+// products of up to 2^25 limbs (~300M digits) are exact.
+/*---------------------------------------------------------------------------------*/
+#define NTT_PRIMES			3
+#define NTT_MAX_LOG2		25
+
+typedef struct {
+	uint32_t p;
+	uint32_t generator;
+	uint32_t negInverse;	// -p^-1 mod 2^32
+	uint32_t r2;			// 2^64 mod p
+} nttPrime_t;
+
+static nttPrime_t nttPrimes[NTT_PRIMES] = {
+	{ 2013265921UL, 31, 0, 0 },	// 15 * 2^27 + 1
+	{ 469762049UL, 3, 0, 0 },	// 7 * 2^26 + 1
+	{ 167772161UL, 3, 0, 0 },	// 5 * 2^25 + 1
+};
+
+static uint32_t powMod(uint64_t base, uint64_t exponent, uint32_t p)
+{
+	uint64_t result = 1;
+
+	base %= p;
+	while (exponent > 0) {
+		if (exponent & 1) {
+			result = result * base % p;
+		}
+		base = base * base % p;
+		exponent >>= 1;
+	}
+	return (uint32_t)result;
+}
+
+static void nttSetup(void)
+{
+	for (uint8_t i = 0; i < NTT_PRIMES; i++) {
+		nttPrime_t *prime = &nttPrimes[i];
+		if (prime->r2 != 0) {
+			continue;
+		}
+		// Newton iteration for p^-1 mod 2^32, five steps from 1 bit
+		uint32_t inverse = 1;
+		for (uint8_t k = 0; k < 5; k++) {
+			inverse *= 2 - prime->p * inverse;
+		}
+		prime->negInverse = -inverse;
+		uint64_t r = ((uint64_t)1 << 32) % prime->p;
+		prime->r2 = (uint32_t)(r * r % prime->p);
+	}
+}
+
+// Montgomery product a * b / 2^32 mod p
+static inline uint32_t montMul(uint32_t a, uint32_t b, const nttPrime_t *prime)
+{
+	uint64_t t = (uint64_t)a * b;
+	uint32_t m = (uint32_t)t * prime->negInverse;
+	uint32_t u = (uint32_t)((t + (uint64_t)m * prime->p) >> 32);
+	return (u >= prime->p) ? u - prime->p : u;
+}
+
+// Powers w^0 .. w^(n/2-1) of the root w in Montgomery form
+static void nttRoots(uint32_t *roots, size_t n, uint32_t root, const nttPrime_t *prime)
+{
+	uint32_t w = montMul(root, prime->r2, prime);
+	uint32_t x = montMul(1, prime->r2, prime);
+
+	for (size_t j = 0; j < n / 2; j++) {
+		roots[j] = x;
+		x = montMul(x, w, prime);
+	}
+}
+
+// Decimation in frequency, natural order in, bit reversed order out
+static void nttForward(uint32_t *a, size_t n, const uint32_t *roots, const nttPrime_t *prime)
+{
+	uint32_t p = prime->p;
+
+	for (size_t len = n / 2, stride = 1; len >= 1; len /= 2, stride *= 2) {
+		for (size_t i = 0; i < n; i += 2 * len) {
+			for (size_t j = 0; j < len; j++) {
+				uint32_t u = a[i + j];
+				uint32_t v = a[i + j + len];
+				uint32_t sum = u + v;
+				a[i + j] = (sum >= p) ? sum - p : sum;
+				a[i + j + len] = montMul((u >= v) ? u - v : u + p - v, roots[j * stride], prime);
+			}
+		}
+	}
+}
+
+// Decimation in time with the inverse roots, bit reversed in, natural out
+static void nttInverse(uint32_t *a, size_t n, const uint32_t *roots, const nttPrime_t *prime)
+{
+	uint32_t p = prime->p;
+
+	for (size_t len = 1, stride = n / 2; len < n; len *= 2, stride /= 2) {
+		for (size_t i = 0; i < n; i += 2 * len) {
+			for (size_t j = 0; j < len; j++) {
+				uint32_t u = a[i + j];
+				uint32_t v = montMul(a[i + j + len], roots[j * stride], prime);
+				uint32_t sum = u + v;
+				a[i + j] = (sum >= p) ? sum - p : sum;
+				a[i + j + len] = (u >= v) ? u - v : u + p - v;
+			}
+		}
+	}
+}
+
+// residue[0..n) = (a * b mod p), the cyclic convolution of length n
+static void nttConvolve(uint32_t *residue, uint32_t *work, uint32_t *roots, size_t n,
+	const uint32_t *a, size_t na, const uint32_t *b, size_t nb, const nttPrime_t *prime)
+{
+	uint32_t p = prime->p;
+	uint32_t root = powMod(prime->generator, (p - 1) / n, p);
+
+	// Inputs in Montgomery form, zero padded
+	for (size_t i = 0; i < n; i++) {
+		residue[i] = (i < na) ? montMul(a[i] % p, prime->r2, prime) : 0;
+	}
+	nttRoots(roots, n, root, prime);
+	nttForward(residue, n, roots, prime);
+	if (a == b && na == nb) {
+		for (size_t i = 0; i < n; i++) {
+			residue[i] = montMul(residue[i], residue[i], prime);
+		}
+	} else {
+		for (size_t i = 0; i < n; i++) {
+			work[i] = (i < nb) ? montMul(b[i] % p, prime->r2, prime) : 0;
+		}
+		nttForward(work, n, roots, prime);
+		for (size_t i = 0; i < n; i++) {
+			residue[i] = montMul(residue[i], work[i], prime);
+		}
+	}
+
+	// Inverse transform, then scale by 1/n and leave the Montgomery form
+	nttRoots(roots, n, powMod(root, p - 2, p), prime);
+	nttInverse(residue, n, roots, prime);
+	uint32_t nInverse = powMod(n, p - 2, p);
+	for (size_t i = 0; i < n; i++) {
+		residue[i] = montMul(residue[i], nInverse, prime);
+	}
+}
+
+// r[0..na+nb) = a * b
+static void mulNtt(uint32_t *r, const uint32_t *a, size_t na, const uint32_t *b, size_t nb)
+{
+	size_t n = 1;
+	while (n < na + nb) {
+		n *= 2;
+	}
+	if (n > ((size_t)1 << NTT_MAX_LOG2)) {
+		fprintf(stderr, "bignum: product of %zu limbs exceeds the NTT length\n", na + nb);
+		exit(EXIT_FAILURE);
+	}
+	nttSetup();
+
+	uint32_t *residues = limbAlloc(NTT_PRIMES * n + n + n / 2);
+	uint32_t *work = residues + NTT_PRIMES * n;
+	uint32_t *roots = work + n;
+	for (uint8_t i = 0; i < NTT_PRIMES; i++) {
+		nttConvolve(residues + i * n, work, roots, n, a, na, b, nb, &nttPrimes[i]);
+	}
+
+	// Garner: c = r0 + p0 (k1 + p1 k2), then carries in radix 10^9
+	const uint64_t p0 = nttPrimes[0].p, p1 = nttPrimes[1].p, p2 = nttPrimes[2].p;
+	const uint64_t inverseP0ModP1 = powMod(p0, p1 - 2, (uint32_t)p1);
+	const uint64_t inverseP0P1ModP2 = powMod(p0 * p1 % p2, p2 - 2, (uint32_t)p2);
+	unsigned __int128 carry = 0;
+
+	for (size_t i = 0; i < na + nb; i++) {
+		uint64_t r0 = residues[i];
+		uint64_t r1 = residues[n + i];
+		uint64_t r2 = residues[2 * n + i];
+		uint64_t k1 = (r1 + p1 - r0 % p1) % p1 * inverseP0ModP1 % p1;
+		uint64_t x01 = r0 + p0 * k1;
+		uint64_t k2 = (r2 + p2 - x01 % p2) % p2 * inverseP0P1ModP2 % p2;
+		unsigned __int128 column = (unsigned __int128)x01 + (unsigned __int128)(p0 * p1) * k2 + carry;
+		carry = column / BN_RADIX;
+		r[i] = (uint32_t)(column - carry * BN_RADIX);
+	}
+	limbFree(residues);
+}
+
+/*---------------------------------------------------------------------------------*/
+// Signed numbers
+/*---------------------------------------------------------------------------------*/
+static void reserve(bignum_t *a, size_t limbs)
+{
+	if (a->capacity < limbs) {
+		uint32_t *limb = limbAlloc(limbs);
+		if (a->length > 0) {
+			memcpy(limb, a->limb, a->length * sizeof(uint32_t));
+		}
+		limbFree(a->limb);
+		a->limb = limb;
+		a->capacity = limbs;
+	}
+}
+
+static void normalize(bignum_t *a)
+{
+	while (a->length > 0 && a->limb[a->length - 1] == 0) {
+		a->length--;
+	}
+	if (a->length == 0) {
+		a->negative = false;
+	}
+}
+
+void bnInit(bignum_t *a)
+{
+	a->limb = NULL;
+	a->length = 0;
+	a->capacity = 0;
+	a->negative = false;
+}
+
+void bnFree(bignum_t *a)
+{
+	limbFree(a->limb);
+	bnInit(a);
+}
+
+void bnSetInt(bignum_t *a, int64_t value)
+{
+	uint64_t magnitude = (value < 0) ? (uint64_t)(-(value + 1)) + 1 : (uint64_t)value;
+
+	reserve(a, 3);
+	a->length = 0;
+	while (magnitude > 0) {
+		a->limb[a->length++] = (uint32_t)(magnitude % BN_RADIX);
+		magnitude /= BN_RADIX;
+	}
+	a->negative = (value < 0);
+}
+
+void bnCopy(bignum_t *dst, const bignum_t *src)
+{
+	if (dst == src) {
+		return;
+	}
+	reserve(dst, src->length);
+	if (src->length > 0) {
+		memcpy(dst->limb, src->limb, src->length * sizeof(uint32_t));
+	}
+	dst->length = src->length;
+	dst->negative = src->negative;
+}
+
+void bnSwap(bignum_t *a, bignum_t *b)
+{
+	bignum_t t = *a;
+	*a = *b;
+	*b = t;
+}
+
+bool bnIsZero(const bignum_t *a)
+{
+	return a->length == 0;
+}
+
+int bnCompareAbs(const bignum_t *a, const bignum_t *b)
+{
+	if (a->length != b->length) {
+		return (a->length > b->length) ? 1 : -1;
+	}
+	for (size_t i = a->length; i > 0; i--) {
+		if (a->limb[i - 1] != b->limb[i - 1]) {
+			return (a->limb[i - 1] > b->limb[i - 1]) ? 1 : -1;
+		}
+	}
+	return 0;
+}
+
+// r = a + b, with bNegative taking the place of the sign of b
+static void addSigned(bignum_t *r, const bignum_t *a, const bignum_t *b, bool bNegative)
+{
+	if (a->negative == bNegative) {
+		const bignum_t *big = (a->length >= b->length) ? a : b;
+		const bignum_t *small = (big == a) ? b : a;
+		bignum_t sum;
+		bnInit(&sum);
+		reserve(&sum, big->length + 1);
+		memcpy(sum.limb, big->limb, big->length * sizeof(uint32_t));
+		sum.limb[big->length] = 0;
+		limbsAdd(sum.limb, big->length + 1, small->limb, small->length);
+		sum.length = big->length + 1;
+		sum.negative = a->negative;
+		normalize(&sum);
+		bnSwap(r, &sum);
+		bnFree(&sum);
+	} else {
+		bool aBigger = bnCompareAbs(a, b) >= 0;
+		const bignum_t *big = aBigger ? a : b;
+		const bignum_t *small = aBigger ? b : a;
+		bignum_t difference;
+		bnInit(&difference);
+		reserve(&difference, big->length);
+		memcpy(difference.limb, big->limb, big->length * sizeof(uint32_t));
+		limbsSub(difference.limb, big->length, small->limb, small->length);
+		difference.length = big->length;
+		difference.negative = aBigger ? a->negative : bNegative;
+		normalize(&difference);
+		bnSwap(r, &difference);
+		bnFree(&difference);
+	}
+}
+
+void bnAdd(bignum_t *r, const bignum_t *a, const bignum_t *b)
+{
+	addSigned(r, a, b, b->negative);
+}
+
+void bnSub(bignum_t *r, const bignum_t *a, const bignum_t *b)
+{
+	addSigned(r, a, b, !b->negative && b->length > 0);
+}
+
+void bnMul(bignum_t *r, const bignum_t *a, const bignum_t *b)
+{
+	if (a->length == 0 || b->length == 0) {
+		bnSetInt(r, 0);
+		return;
+	}
+
+	const bignum_t *big = (a->length >= b->length) ? a : b;
+	const bignum_t *small = (big == a) ? b : a;
+	bignum_t product;
+
+	bnInit(&product);
+	reserve(&product, a->length + b->length);
+	if (small->length >= NTT_THRESHOLD) {
+		mulNtt(product.limb, big->limb, big->length, small->limb, small->length);
+	} else if (big->length == small->length) {
+		mulKaratsuba(product.limb, big->limb, small->limb, big->length);
+	} else {
+		mulUnbalanced(product.limb, big->limb, big->length, small->limb, small->length);
+	}
+	product.length = a->length + b->length;
+	product.negative = (a->negative != b->negative);
+	normalize(&product);
+	bnSwap(r, &product);
+	bnFree(&product);
+}
+
+void bnMulSmall(bignum_t *a, uint32_t factor)
+{
+	uint64_t carry = 0;
+
+	for (size_t i = 0; i < a->length; i++) {
+		uint64_t x = (uint64_t)a->limb[i] * factor + carry;
+		carry = x / BN_RADIX;
+		a->limb[i] = (uint32_t)(x - carry * BN_RADIX);
+	}
+	if (carry > 0) {
+		reserve(a, a->length + 1);
+		a->limb[a->length++] = (uint32_t)carry;
+	}
+	normalize(a);
+}
+
+void bnShiftRight(bignum_t *a, size_t limbs)
+{
+	if (limbs >= a->length) {
+		a->length = 0;
+		a->negative = false;
+		return;
+	}
+	memmove(a->limb, a->limb + limbs, (a->length - limbs) * sizeof(uint32_t));
+	a->length -= limbs;
+}
+
+void bnShiftLeft(bignum_t *a, size_t limbs)
+{
+	if (a->length == 0 || limbs == 0) {
+		return;
+	}
+	reserve(a, a->length + limbs);
+	memmove(a->limb + limbs, a->limb, a->length * sizeof(uint32_t));
+	memset(a->limb, 0, limbs * sizeof(uint32_t));
+	a->length += limbs;
+}
+
+double bnLeading(const bignum_t *a)
+{
+	double value = 0.0;
+	double scale = 1.0;
+
+	for (size_t i = a->length; i > 0 && a->length - i < 3; i--) {
+		value += a->limb[i - 1] * scale;
+		scale /= BN_RADIX;
+	}
+	return a->negative ? -value : value;
+}
@@ -0,0 +1,62 @@
+/*
+ * bignum.h
+ *
+ * Created: 16.10.2026
+ *
+ * Arbitrary precision integers for the host tools. Limbs hold 9 decimal
+ * digits (radix 10^9), least significant first, so the digits of a result
+ * are printed without a base conversion. Products use Karatsuba above a
+ * threshold and a three-prime number theoretic transform for long numbers.
+ * All limb memory goes through a counting allocator for the memory report
+ * of the benchmark. Needs a 64-bit gcc or clang (unsigned __int128).
+ */
+
+
+#ifndef BIGNUM_H_
+#define BIGNUM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define BN_RADIX			1000000000UL
+#define BN_RADIX_DIGITS		9
+
+typedef struct {
+	uint32_t *limb;		// magnitude, least significant limb first
+	size_t length;		// used limbs, no leading zero limbs
+	size_t capacity;
+	bool negative;
+} bignum_t;
+
+void bnInit(bignum_t *a);
+void bnFree(bignum_t *a);
+void bnSetInt(bignum_t *a, int64_t value);
+void bnCopy(bignum_t *dst, const bignum_t *src);
+void bnSwap(bignum_t *a, bignum_t *b);
+bool bnIsZero(const bignum_t *a);
+
+// r = a + b, r = a - b, r = a * b; r may be one of the operands
+void bnAdd(bignum_t *r, const bignum_t *a, const bignum_t *b);
+void bnSub(bignum_t *r, const bignum_t *a, const bignum_t *b);
+void bnMul(bignum_t *r, const bignum_t *a, const bignum_t *b);
+
+// a *= factor, factor below the radix
+void bnMulSmall(bignum_t *a, uint32_t factor);
+
+// a = a / radix^limbs (truncated) resp. a = a * radix^limbs
+void bnShiftRight(bignum_t *a, size_t limbs);
+void bnShiftLeft(bignum_t *a, size_t limbs);
+
+// Compares the magnitudes
+int bnCompareAbs(const bignum_t *a, const bignum_t *b);
+
+// Leading limbs as a double, scaled by radix^-(length-1)
+double bnLeading(const bignum_t *a);
+
+// Bytes of limb memory currently allocated and the peak since the last reset
+size_t bnMemoryInUse(void);
+size_t bnMemoryPeak(void);
+void bnMemoryResetPeak(void);
+
+#endif /* BIGNUM_H_ */
@@ -0,0 +1,45 @@
+/*
+ * checkpointDump.c
+ *
+ * Created: 16.10.2026
+ *
+ * Lists the checkpoint records in an EEPROM image read out of the board.
+ *
+ *   checkpointDump <image> [slotBytes]     slotBytes defaults to 168
+ *
+ * Every slot is printed with its owner (engine index and record version),
+ * sequence and payload length, or as empty resp. damaged.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "checkpoint.h"
+#include "nvStoreFile.h"
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <image> [slotBytes]\n", argv[0]);
+		return 1;
+	}
+	unsigned slotBytes = (argc > 2) ? (unsigned)strtoul(argv[2], NULL, 10) : 168;
+	if (slotBytes <= CHECKPOINT_OVERHEAD || slotBytes > 255 || !nvStoreFileOpen(argv[1], false)) {
+		fprintf(stderr, "cannot open %s or bad slot size\n", argv[1]);
+		return 1;
+	}
+
+	for (unsigned address = 0; address + slotBytes <= nvStoreFile.size; address += slotBytes) {
+		checkpointHeader_t header;
+		uint8_t magic;
+		nvStoreFile.read(address, &magic, 1);
+		printf("slot %2u @%4u: ", address / slotBytes, address);
+		if (checkpointRecordValid(&nvStoreFile, address, slotBytes, &header)) {
+			printf("engine %u version %u sequence %u length %u\n", header.id & 0x0F, header.id >> 4,
+				(unsigned)header.sequence, header.length);
+		} else {
+			printf("%s\n", (magic == 0xFF) ? "empty" : "damaged");
+		}
+	}
+	nvStoreFileClose();
+	return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * checkpointTest.c
+ *
+ * Created: 16.10.2026
+ *
+ * Runs the firmware's checkpoint code against a file backed nvStore and
+ * checks save and load, the rotation through the ring, the fallback to the
+ * older record when the newest one is torn by a reset or has a bad CRC, and
+ * the refusal of a record whose length does not match.
+ *
+ *   checkpointTest [image]     image defaults to checkpointTest.bin, it is
+ *                              overwritten and removed again
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "checkpoint.h"
+#include "nvStoreFile.h"
+
+// A small ring away from address 0, so the slot addressing is checked too
+#define TEST_BASE		16
+#define TEST_SLOTS		4
+#define TEST_SLOT_SIZE	24
+#define TEST_ID			0x13
+#define TEST_HEAD		3
+#define TEST_BODY		8
+
+static int failures = 0;
+
+static void check(bool condition, const char *what)
+{
+	printf("%-48s %s\n", what, condition ? "ok" : "FAILED");
+	failures += !condition;
+}
+
+// Payload of the n-th save, different in every byte
+static void fillRecord(uint32_t n, uint8_t head[TEST_HEAD], uint8_t body[TEST_BODY])
+{
+	for (uint8_t i = 0; i < TEST_HEAD; i++) {
+		head[i] = (uint8_t)(n * 7 + i);
+	}
+	for (uint8_t i = 0; i < TEST_BODY; i++) {
+		body[i] = (uint8_t)(n * 13 + 100 + i);
+	}
+}
+
+static bool save(checkpointRing_t *ring, uint32_t n)
+{
+	uint8_t head[TEST_HEAD], body[TEST_BODY];
+
+	fillRecord(n, head, body);
+	return checkpointSave(ring, head, TEST_HEAD, body, TEST_BODY);
+}
+
+// True if the ring loads the payload of the n-th save
+static bool loads(const checkpointRing_t *ring, uint32_t n)
+{
+	uint8_t head[TEST_HEAD], body[TEST_BODY], wantHead[TEST_HEAD], wantBody[TEST_BODY];
+
+	fillRecord(n, wantHead, wantBody);
+	return checkpointLoad(ring, head, TEST_HEAD, body, TEST_BODY) &&
+		memcmp(head, wantHead, TEST_HEAD) == 0 && memcmp(body, wantBody, TEST_BODY) == 0;
+}
+
+// Rescans the image like a reboot does
+static void reboot(checkpointRing_t *ring, const nvStore_t *store)
+{
+	checkpointRingInit(ring, store, TEST_BASE, TEST_SLOTS, TEST_SLOT_SIZE, TEST_ID);
+}
+
+static uint16_t slotAddress(uint8_t slot)
+{
+	return TEST_BASE + (uint16_t)slot * TEST_SLOT_SIZE;
+}
+
+// Store that loses every write after the first tornWrites, as if the board
+// were reset in the middle of a save
+static int tornWrites;
+
+static void tornWrite(uint16_t address, const void *data, uint16_t length)
+{
+	if (tornWrites > 0) {
+		tornWrites--;
+		nvStoreFile.write(address, data, length);
+	}
+}
+
+static void tornRead(uint16_t address, void *data, uint16_t length)
+{
+	nvStoreFile.read(address, data, length);
+}
+
+static const nvStore_t tornStore = {
+	.read = tornRead,
+	.write = tornWrite,
+	.size = NV_STORE_FILE_SIZE,
+};
+
+int main(int argc, char *argv[])
+{
+	const char *path = (argc > 1) ? argv[1] : "checkpointTest.bin";
+	checkpointRing_t ring;
+	char what[64];
+
+	remove(path);
+	if (!nvStoreFileOpen(path, true)) {
+		fprintf(stderr, "cannot create %s\n", path);
+		return EXIT_FAILURE;
+	}
+
+	// Empty image: nothing to load, the first save goes to slot 0
+	reboot(&ring, &nvStoreFile);
+	check(ring.newest == TEST_SLOTS && !loads(&ring, 0), "erased image has no record");
+	check(save(&ring, 1) && ring.newest == 0, "first save goes to slot 0");
+	check(loads(&ring, 1), "save and load");
+	reboot(&ring, &nvStoreFile);
+	check(ring.newest == 0 && ring.sequence == 1 && loads(&ring, 1), "record survives a reboot");
+
+	// Ten saves run two and a half times around the four slots
+	for (uint32_t n = 2; n <= 10; n++) {
+		save(&ring, n);
+	}
+	snprintf(what, sizeof(what), "10 saves end in slot %u", (10 - 1) % TEST_SLOTS);
+	check(ring.newest == (10 - 1) % TEST_SLOTS && ring.sequence == 10, what);
+	reboot(&ring, &nvStoreFile);
+	check(ring.newest == (10 - 1) % TEST_SLOTS && ring.sequence == 10 && loads(&ring, 10), "reboot finds the newest after wraparound");
+	bool older = true;
+	for (uint8_t slot = 0; slot < TEST_SLOTS; slot++) {
+		checkpointHeader_t header;
+		older &= checkpointRecordValid(&nvStoreFile, slotAddress(slot), TEST_SLOT_SIZE, &header) &&
+			header.sequence == 10U - ((ring.newest + TEST_SLOTS - slot) % TEST_SLOTS);
+	}
+	check(older, "all slots hold the last four records");
+
+	// Save 11 is cut off before its CRC: the ring falls back to 10
+	tornWrites = 3;
+	checkpointRing_t tornRing = ring;
+	tornRing.store = &tornStore;
+	save(&tornRing, 11);
+	reboot(&ring, &nvStoreFile);
+	check(ring.sequence == 10 && loads(&ring, 10), "torn newest slot falls back to the older one");
+
+	// The next save overwrites the torn slot and is found again
+	check(save(&ring, 11) && ring.newest == 10 % TEST_SLOTS, "save after a torn one reuses its slot");
+	reboot(&ring, &nvStoreFile);
+	check(ring.sequence == 11 && loads(&ring, 11), "record after the torn one loads");
+
+	// One flipped payload byte in the newest slot: its CRC fails
+	uint8_t byte;
+	uint16_t address = slotAddress(ring.newest) + CHECKPOINT_HEADER_BYTES + 2;
+	nvStoreFile.read(address, &byte, 1);
+	byte ^= 0x01;
+	nvStoreFile.write(address, &byte, 1);
+	check(!loads(&ring, 11), "load checks the CRC again");
+	reboot(&ring, &nvStoreFile);
+	check(ring.sequence == 10 && loads(&ring, 10), "CRC-bad newest slot falls back to the older one");
+
+	// A record of another length is refused and the buffers stay untouched
+	uint8_t head[TEST_HEAD], body[TEST_BODY - 1];
+	memset(head, 0xA5, sizeof(head));
+	memset(body, 0xA5, sizeof(body));
+	bool loaded = checkpointLoad(&ring, head, TEST_HEAD, body, TEST_BODY - 1);
+	bool untouched = true;
+	for (size_t i = 0; i < sizeof(head); i++) {
+		untouched &= (head[i] == 0xA5);
+	}
+	for (size_t i = 0; i < sizeof(body); i++) {
+		untouched &= (body[i] == 0xA5);
+	}
+	check(!loaded && untouched, "length mismatch is refused");
+
+	// A payload that does not fit a slot is not written
+	uint8_t large[TEST_SLOT_SIZE];
+	memset(large, 0, sizeof(large));
+	uint8_t newest = ring.newest;
+	check(!checkpointSave(&ring, large, sizeof(large), NULL, 0) && ring.newest == newest, "oversized record is refused");
+
+	nvStoreFileClose();
+	remove(path);
+	printf("checkpoint: %s\n", (failures == 0) ? "all checks pass" : "checks failed");
+	return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,66 @@
+/*
+ * nvStoreFile.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "nvStoreFile.h"
+
+static FILE *image = NULL;
+static bool imageWritable = false;
+
+bool nvStoreFileOpen(const char *path, bool writable)
+{
+	if (!writable) {
+		image = fopen(path, "rb");
+	} else {
+		image = fopen(path, "r+b");
+		if (image == NULL) {
+			image = fopen(path, "w+b");
+		}
+	}
+	imageWritable = writable;
+	return image != NULL;
+}
+
+void nvStoreFileClose(void)
+{
+	if (image != NULL) {
+		fclose(image);
+		image = NULL;
+	}
+}
+
+static void fileRead(uint16_t address, void *data, uint16_t length)
+{
+	memset(data, 0xFF, length);
+	if (fseek(image, address, SEEK_SET) == 0) {
+		size_t got = fread(data, 1, length, image);
+		(void)got;	// the rest stays erased
+	}
+}
+
+static void fileWrite(uint16_t address, const void *data, uint16_t length)
+{
+	if (!imageWritable) {
+		return;
+	}
+	// Fill a gap up to address with erased bytes
+	fseek(image, 0, SEEK_END);
+	long end = ftell(image);
+	while (end < address) {
+		fputc(0xFF, image);
+		end++;
+	}
+	fseek(image, address, SEEK_SET);
+	fwrite(data, 1, length, image);
+	fflush(image);
+}
+
+const nvStore_t nvStoreFile = {
+	.read = fileRead,
+	.write = fileWrite,
+	.size = NV_STORE_FILE_SIZE,
+};
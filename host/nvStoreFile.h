@@ -0,0 +1,28 @@
+/*
+ * nvStoreFile.h
+ *
+ * Created: 16.10.2026
+ *
+ * nvStore backed by a file holding an EEPROM image, for running the
+ * checkpoint code on the host. A missing or short file reads as erased
+ * EEPROM (0xFF).
+ */
+
+
+#ifndef NVSTOREFILE_H_
+#define NVSTOREFILE_H_
+
+#include <stdbool.h>
+#include "nvStore.h"
+
+// Size of the XMEGA128A3U EEPROM
+#define NV_STORE_FILE_SIZE	2048
+
+// Opens the image, must be called before nvStoreFile is used. Writable
+// opens create a missing image, read-only ones fail on it and ignore writes.
+bool nvStoreFileOpen(const char *path, bool writable);
+void nvStoreFileClose(void);
+
+extern const nvStore_t nvStoreFile;
+
+#endif /* NVSTOREFILE_H_ */
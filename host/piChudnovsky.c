@@ -0,0 +1,366 @@
+/*
+ * piChudnovsky.c
+ *
+ * Created: 16.10.2026
+ */
+
+#include <string.h>
+#include <math.h>
+#include "piChudnovsky.h"
+
+#define DIGITS_PER_TERM		14.181647462725477
+#define C3_OVER_24			10939058860032000ULL	// 640320^3 / 24
+#define TERM_A				13591409UL
+#define TERM_B				545140134UL
+
+// Limbs below the last printed digit that absorb the truncation errors
+#define GUARD_LIMBS			3
+
+/*---------------------------------------------------------------------------------*/
+// Fixed point: a bignum x stands for x / radix^limbs
+/*---------------------------------------------------------------------------------*/
+static void fixedMul(bignum_t *r, const bignum_t *a, const bignum_t *b, size_t limbs)
+{
+	bnMul(r, a, b);
+	bnShiftRight(r, limbs);
+}
+
+// a / 2 = a * (radix / 2) / radix
+static void fixedHalf(bignum_t *a)
+{
+	bnMulSmall(a, BN_RADIX / 2);
+	bnShiftRight(a, 1);
+}
+
+static void fixedFromDouble(bignum_t *a, double value, size_t limbs)
+{
+	bnSetInt(a, 0);
+	for (size_t i = 0; i < limbs + 1; i++) {
+		uint32_t limb = (uint32_t)value;
+		bignum_t digit;
+		bnInit(&digit);
+		bnSetInt(&digit, limb);
+		bnShiftLeft(a, 1);
+		bnAdd(a, a, &digit);
+		bnFree(&digit);
+		value = (value - limb) * BN_RADIX;
+	}
+}
+
+// Precision schedule of the Newton iterations: every step roughly doubles
+// the correct limbs, so it only needs half of the final length plus one.
+// Returns the number of steps, sizes[0] is the seed precision.
+static uint8_t newtonSchedule(size_t limbs, size_t *sizes)
+{
+	size_t reversed[CHUDNOVSKY_STACK_DEPTH];
+	uint8_t count = 0;
+
+	while (limbs > 3 && count < CHUDNOVSKY_STACK_DEPTH - 1) {
+		reversed[count++] = limbs;
+		limbs = limbs / 2 + 1;
+	}
+	reversed[count++] = limbs;
+	for (uint8_t i = 0; i < count; i++) {
+		sizes[i] = reversed[count - 1 - i];
+	}
+	return count;
+}
+
+// Moves a fixed-point number from one precision to another
+static void fixedRescale(bignum_t *a, size_t from, size_t to)
+{
+	if (to > from) {
+		bnShiftLeft(a, to - from);
+	} else {
+		bnShiftRight(a, from - to);
+	}
+}
+
+// y = 1 / x, x given with limbs fraction limbs and 1 <= x < radix
+static void fixedReciprocal(bignum_t *y, const bignum_t *x, size_t limbs)
+{
+	size_t sizes[CHUDNOVSKY_STACK_DEPTH];
+	uint8_t steps = newtonSchedule(limbs, sizes);
+	bignum_t xp, e, one, correction;
+
+	bnInit(&xp);
+	bnInit(&e);
+	bnInit(&one);
+	bnInit(&correction);
+
+	// Seed from the leading limbs, good for ~15 digits
+	fixedFromDouble(y, 1.0 / bnLeading(x), sizes[0]);
+
+	for (uint8_t i = 0; i < steps; i++) {
+		size_t p = sizes[i];
+		if (i > 0) {
+			fixedRescale(y, sizes[i - 1], p);
+		}
+
+		// y += y (1 - x y)
+		bnCopy(&xp, x);
+		fixedRescale(&xp, limbs, p);
+		fixedMul(&e, &xp, y, p);
+		bnSetInt(&one, 1);
+		bnShiftLeft(&one, p);
+		bnSub(&e, &one, &e);
+		fixedMul(&correction, y, &e, p);
+		bnAdd(y, y, &correction);
+	}
+
+	bnFree(&xp);
+	bnFree(&e);
+	bnFree(&one);
+	bnFree(&correction);
+}
+
+// y = sqrt(c) via 1/sqrt(c): y += y (1 - c y^2) / 2
+static void fixedSqrtSmall(bignum_t *root, uint32_t c, size_t limbs)
+{
+	size_t sizes[CHUDNOVSKY_STACK_DEPTH];
+	uint8_t steps = newtonSchedule(limbs, sizes);
+	bignum_t y, e, one, correction;
+
+	bnInit(&y);
+	bnInit(&e);
+	bnInit(&one);
+	bnInit(&correction);
+
+	fixedFromDouble(&y, 1.0 / sqrt((double)c), sizes[0]);
+
+	for (uint8_t i = 0; i < steps; i++) {
+		size_t p = sizes[i];
+		if (i > 0) {
+			fixedRescale(&y, sizes[i - 1], p);
+		}
+
+		fixedMul(&e, &y, &y, p);
+		bnMulSmall(&e, c);
+		bnSetInt(&one, 1);
+		bnShiftLeft(&one, p);
+		bnSub(&e, &one, &e);
+		fixedMul(&correction, &y, &e, p);
+		fixedHalf(&correction);
+		bnAdd(&y, &y, &correction);
+	}
+	bnCopy(root, &y);
+	bnMulSmall(root, c);
+
+	bnFree(&y);
+	bnFree(&e);
+	bnFree(&one);
+	bnFree(&correction);
+}
+
+/*---------------------------------------------------------------------------------*/
+// Binary splitting
+/*---------------------------------------------------------------------------------*/
+
+// P, Q, T of the single term k
+static void termSplit(chudnovskySplit_t *split, uint64_t k)
+{
+	bignum_t factor;
+	bnInit(&factor);
+
+	if (k == 0) {
+		bnSetInt(&split->p, 1);
+		bnSetInt(&split->q, 1);
+	} else {
+		// P = -(6k-5)(2k-1)(6k-1), Q = k^3 C^3 / 24
+		bnSetInt(&split->p, -(int64_t)(6 * k - 5));
+		bnSetInt(&factor, (int64_t)(2 * k - 1));
+		bnMul(&split->p, &split->p, &factor);
+		bnSetInt(&factor, (int64_t)(6 * k - 1));
+		bnMul(&split->p, &split->p, &factor);
+
+		bnSetInt(&split->q, (int64_t)k);
+		bnMul(&split->q, &split->q, &split->q);
+		bnSetInt(&factor, (int64_t)k);
+		bnMul(&split->q, &split->q, &factor);
+		bnSetInt(&factor, (int64_t)C3_OVER_24);
+		bnMul(&split->q, &split->q, &factor);
+	}
+
+	// T = P (A + B k)
+	bnSetInt(&factor, (int64_t)k);
+	bnMulSmall(&factor, TERM_B);
+	bnSetInt(&split->t, TERM_A);
+	bnAdd(&factor, &factor, &split->t);
+	bnMul(&split->t, &split->p, &factor);
+	split->terms = 1;
+
+	bnFree(&factor);
+}
+
+// left = left . right: P = Pl Pr, Q = Ql Qr, T = Tl Qr + Pl Tr
+static void mergeSplits(chudnovskySplit_t *left, chudnovskySplit_t *right)
+{
+	bnMul(&left->t, &left->t, &right->q);
+	bnMul(&right->t, &left->p, &right->t);
+	bnAdd(&left->t, &left->t, &right->t);
+	bnMul(&left->p, &left->p, &right->p);
+	bnMul(&left->q, &left->q, &right->q);
+	left->terms += right->terms;
+}
+
+static void mergeTop(chudnovskyState_t *state)
+{
+	chudnovskySplit_t *right = &state->stack[state->depth - 1];
+	chudnovskySplit_t *left = &state->stack[state->depth - 2];
+
+	mergeSplits(left, right);
+	bnFree(&right->p);
+	bnFree(&right->q);
+	bnFree(&right->t);
+	state->depth--;
+}
+
+/*---------------------------------------------------------------------------------*/
+// Engine
+/*---------------------------------------------------------------------------------*/
+static void releaseAll(chudnovskyState_t *state)
+{
+	for (uint8_t i = 0; i < CHUDNOVSKY_STACK_DEPTH; i++) {
+		bnFree(&state->stack[i].p);
+		bnFree(&state->stack[i].q);
+		bnFree(&state->stack[i].t);
+	}
+	bnFree(&state->root);
+	bnFree(&state->pi);
+}
+
+void chudnovskyInit(chudnovskyState_t *state, uint64_t digits)
+{
+	memset(state, 0, sizeof(*state));
+	state->digits = digits;
+	state->terms = (uint64_t)(digits / DIGITS_PER_TERM) + 2;
+	state->limbs = (size_t)((digits + BN_RADIX_DIGITS - 1) / BN_RADIX_DIGITS) + GUARD_LIMBS;
+	for (uint8_t i = 0; i < CHUDNOVSKY_STACK_DEPTH; i++) {
+		bnInit(&state->stack[i].p);
+		bnInit(&state->stack[i].q);
+		bnInit(&state->stack[i].t);
+	}
+	bnInit(&state->root);
+	bnInit(&state->pi);
+	state->phase = CHUDNOVSKY_SERIES;
+	state->running = false;
+}
+
+void chudnovskyFree(chudnovskyState_t *state)
+{
+	releaseAll(state);
+	state->running = false;
+}
+
+void chudnovskyStart(chudnovskyState_t *state)
+{
+	state->running = true;
+}
+
+void chudnovskyStop(chudnovskyState_t *state)
+{
+	state->running = false;
+}
+
+void chudnovskyReset(chudnovskyState_t *state)
+{
+	uint64_t digits = state->digits;
+
+	releaseAll(state);
+	chudnovskyInit(state, digits);
+}
+
+bool chudnovskyStep(chudnovskyState_t *state)
+{
+	if (state->phase == CHUDNOVSKY_DONE) {
+		return false;
+	}
+	if (!state->running) {
+		return true;
+	}
+
+	switch (state->phase) {
+		case CHUDNOVSKY_SERIES:
+		if (state->nextTerm < state->terms) {
+			termSplit(&state->stack[state->depth++], state->nextTerm++);
+			while (state->depth >= 2 && state->stack[state->depth - 1].terms == state->stack[state->depth - 2].terms) {
+				mergeTop(state);
+			}
+		} else if (state->depth >= 2) {
+			// Unequal leftovers of the binary counter, one merge per step
+			mergeTop(state);
+		} else {
+			state->phase = CHUDNOVSKY_ROOT;
+		}
+		break;
+
+		case CHUDNOVSKY_ROOT:
+		fixedSqrtSmall(&state->root, 10005, state->limbs);
+		state->phase = CHUDNOVSKY_DIVIDE;
+		break;
+
+		case CHUDNOVSKY_DIVIDE:
+		{
+			// Q / T with both scaled by the same power of the radix, so that
+			// T has its leading limb in the integer position
+			chudnovskySplit_t *all = &state->stack[0];
+			size_t exponent = all->t.length - 1;
+			bignum_t reciprocal;
+
+			bnInit(&reciprocal);
+			fixedRescale(&all->t, exponent, state->limbs);
+			fixedRescale(&all->q, exponent, state->limbs);
+			bnFree(&all->p);
+
+			fixedReciprocal(&reciprocal, &all->t, state->limbs);
+			bnFree(&all->t);
+			fixedMul(&state->pi, &all->q, &reciprocal, state->limbs);
+			bnFree(&all->q);
+			bnFree(&reciprocal);
+
+			fixedMul(&state->pi, &state->pi, &state->root, state->limbs);
+			bnMulSmall(&state->pi, 426880);
+			bnFree(&state->root);
+			state->phase = CHUDNOVSKY_DONE;
+			state->running = false;
+		}
+		break;
+
+		default:
+		break;
+	}
+	return state->phase != CHUDNOVSKY_DONE;
+}
+
+uint16_t chudnovskyProgress(const chudnovskyState_t *state)
+{
+	switch (state->phase) {
+		case CHUDNOVSKY_SERIES:
+		return (uint16_t)((state->nextTerm * 900) / state->terms);
+		case CHUDNOVSKY_ROOT:
+		return 900;
+		case CHUDNOVSKY_DIVIDE:
+		return 950;
+		default:
+		return 1000;
+	}
+}
+
+void chudnovskyWrite(const chudnovskyState_t *state, FILE *file)
+{
+	const bignum_t *pi = &state->pi;
+	uint64_t remaining = state->digits;
+
+	if (state->phase != CHUDNOVSKY_DONE || pi->length <= state->limbs) {
+		return;
+	}
+	fprintf(file, "%u.", pi->limb[state->limbs]);
+	for (size_t i = state->limbs; i > 0 && remaining > 0; i--) {
+		char group[BN_RADIX_DIGITS + 1];
+		snprintf(group, sizeof(group), "%09u", pi->limb[i - 1]);
+		size_t count = (remaining < BN_RADIX_DIGITS) ? (size_t)remaining : BN_RADIX_DIGITS;
+		fwrite(group, 1, count, file);
+		remaining -= count;
+	}
+	fputc('\n', file);
+}
@@ -0,0 +1,70 @@
+/*
+ * piChudnovsky.h
+ *
+ * Created: 16.10.2026
+ *
+ * Chudnovsky series evaluated by binary splitting, for runs on a PC. Each
+ * term adds ~14.18 digits. The terms are combined like a binary counter:
+ * every new term is pushed on a stack and merged with the top while both
+ * cover the same number of terms, which is the recursive split done from
+ * left to right. Like the engine tasks of the firmware the computation is
+ * driven in steps and obeys start, stop and reset between two steps.
+ */
+
+
+#ifndef PICHUDNOVSKY_H_
+#define PICHUDNOVSKY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "bignum.h"
+
+// Enough for 2^64 terms
+#define CHUDNOVSKY_STACK_DEPTH	64
+
+typedef enum {
+	CHUDNOVSKY_SERIES,		// summing terms
+	CHUDNOVSKY_ROOT,		// sqrt(10005) by Newton iteration
+	CHUDNOVSKY_DIVIDE,		// 426880 sqrt(10005) Q / T
+	CHUDNOVSKY_DONE
+} chudnovskyPhase_t;
+
+typedef struct {
+	bignum_t p, q, t;
+	uint64_t terms;			// terms covered by this entry
+} chudnovskySplit_t;
+
+typedef struct {
+	uint64_t digits;		// decimals after the point
+	uint64_t terms;			// series terms needed for them
+	uint64_t nextTerm;
+	size_t limbs;			// fraction limbs of the fixed-point result
+	chudnovskySplit_t stack[CHUDNOVSKY_STACK_DEPTH];
+	uint8_t depth;
+	bignum_t root;			// sqrt(10005) as fixed point
+	bignum_t pi;			// result as fixed point
+	chudnovskyPhase_t phase;
+	bool running;
+} chudnovskyState_t;
+
+void chudnovskyInit(chudnovskyState_t *state, uint64_t digits);
+void chudnovskyFree(chudnovskyState_t *state);
+
+// Commands of the engine tasks: start/continue, stop (pause) and reset,
+// which stops and discards the partial result
+void chudnovskyStart(chudnovskyState_t *state);
+void chudnovskyStop(chudnovskyState_t *state);
+void chudnovskyReset(chudnovskyState_t *state);
+
+// Does one unit of work if running: a term and the merges it triggers, or
+// one of the final phases. Returns false once the result is complete.
+bool chudnovskyStep(chudnovskyState_t *state);
+
+// Progress in permille; the series counts 90%, root and division 5% each
+uint16_t chudnovskyProgress(const chudnovskyState_t *state);
+
+// Writes "3." and the digits, valid once the phase is CHUDNOVSKY_DONE
+void chudnovskyWrite(const chudnovskyState_t *state, FILE *file);
+
+#endif /* PICHUDNOVSKY_H_ */
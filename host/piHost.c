@@ -0,0 +1,222 @@
+/*
+ * piHost.c
+ *
+ * Created: 16.10.2026
+ *
+ * Command line front end of the host engines.
+ *
+ *   piHost <digits> [file]     computes pi, writes the digits to file or stdout
+ *   piHost -b [maxDigits]      benchmark at 1M, 10M and 100M digits
+ *   piHost -x [n [count]]      BBP hex digits from position n on, without n
+ *                              the firmware's BBP engine is checked against
+ *                              known digits
+ *
+ * Ctrl-C stops the engine like the Stop button and reports the progress.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "piChudnovsky.h"
+#include "piBbp.h"
+
+// Progress output interval and batch length of the engine loop
+#define REPORT_PERIOD_S		1.0
+#define BATCH_PERIOD_S		0.05
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void onInterrupt(int signal)
+{
+	(void)signal;
+	stopRequested = 1;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static long peakResidentKiB(void)
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+}
+
+static const char *phaseName(chudnovskyPhase_t phase)
+{
+	switch (phase) {
+		case CHUDNOVSKY_SERIES: return "series";
+		case CHUDNOVSKY_ROOT: return "sqrt";
+		case CHUDNOVSKY_DIVIDE: return "divide";
+		default: return "done";
+	}
+}
+
+// Hex digits of pi after the point from an independent computation, the
+// position 1000000 run agrees with the BBP paper (26C65E52CB4593...)
+static const struct {
+	uint32_t position;
+	const char *digits;
+} bbpKnown[] = {
+	{ 1, "243F6A88" },
+	{ 1000, "349F1C09" },
+	{ 8183, "9CF746CE" },	// ends at 8190, the last position on the AVR
+	{ 100000, "535EA16C" },
+	{ 1000000, "26C65E52" },
+};
+
+// Hex digit n by one extraction, the way the firmware engine gets it
+static char bbpHexDigit(uint32_t position)
+{
+	bbpState_t state;
+
+	bbpInit(&state, position);
+	while (bbpStep(&state)) {
+	}
+	return "0123456789ABCDEF"[bbpDigit(&state)];
+}
+
+static int bbpDigits(uint32_t position, uint32_t count)
+{
+	if (position < 1 || position + count - 1 > BBP_MAX_POSITION) {
+		fprintf(stderr, "positions 1..%lu with %u-bit residues\n", BBP_MAX_POSITION, BBP_RESIDUE_BITS);
+		return EXIT_FAILURE;
+	}
+	for (uint32_t i = 0; i < count && !stopRequested; i++) {
+		putchar(bbpHexDigit(position + i));
+		fflush(stdout);
+	}
+	putchar('\n');
+	return EXIT_SUCCESS;
+}
+
+static int bbpCheck(void)
+{
+	int failures = 0;
+
+	for (size_t i = 0; i < sizeof(bbpKnown) / sizeof(bbpKnown[0]); i++) {
+		uint32_t length = (uint32_t)strlen(bbpKnown[i].digits);
+		if (bbpKnown[i].position + length - 1 > BBP_MAX_POSITION) {
+			printf("%8lu  skipped, beyond %lu\n", (unsigned long)bbpKnown[i].position, BBP_MAX_POSITION);
+			continue;
+		}
+		char digits[16] = "";
+		for (uint32_t j = 0; j < length; j++) {
+			digits[j] = bbpHexDigit(bbpKnown[i].position + j);
+		}
+		bool match = (strcmp(digits, bbpKnown[i].digits) == 0);
+		printf("%8lu  %s  %s\n", (unsigned long)bbpKnown[i].position, digits, match ? "ok" : "MISMATCH");
+		failures += !match;
+	}
+	printf("BBP %u-bit residues: %s\n", BBP_RESIDUE_BITS, (failures == 0) ? "all digits match" : "digits differ");
+	return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Runs the engine in batches like the firmware tasks. Returns the seconds
+// spent, or a negative value if the run was stopped.
+static double runEngine(chudnovskyState_t *engine, bool verbose)
+{
+	double start = now();
+	double lastReport = start;
+
+	chudnovskyStart(engine);
+	for (;;) {
+		if (stopRequested) {
+			chudnovskyStop(engine);
+			fprintf(stderr, "stopped at %u.%u%% (%s, term %llu of %llu)\n",
+				chudnovskyProgress(engine) / 10, chudnovskyProgress(engine) % 10,
+				phaseName(engine->phase), (unsigned long long)engine->nextTerm,
+				(unsigned long long)engine->terms);
+			return -1.0;
+		}
+
+		double batchStart = now();
+		bool more;
+		do {
+			more = chudnovskyStep(engine);
+		} while (more && (now() - batchStart) < BATCH_PERIOD_S);
+		if (!more) {
+			break;
+		}
+
+		if (verbose && (now() - lastReport) >= REPORT_PERIOD_S) {
+			lastReport = now();
+			fprintf(stderr, "%5.1f%% %-6s %8.1fs %8zu MiB\n", chudnovskyProgress(engine) / 10.0,
+				phaseName(engine->phase), lastReport - start, bnMemoryInUse() >> 20);
+		}
+	}
+	return now() - start;
+}
+
+static int benchmark(uint64_t maxDigits)
+{
+	static const uint64_t sizes[] = { 1000000ULL, 10000000ULL, 100000000ULL };
+
+	printf("%12s %10s %12s %12s %12s\n", "digits", "seconds", "digits/s", "peak MiB", "RSS MiB");
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]) && sizes[i] <= maxDigits; i++) {
+		chudnovskyState_t engine;
+
+		chudnovskyInit(&engine, sizes[i]);
+		bnMemoryResetPeak();
+		double seconds = runEngine(&engine, false);
+		if (seconds < 0) {
+			chudnovskyFree(&engine);
+			return EXIT_FAILURE;
+		}
+		printf("%12llu %10.2f %12.0f %12.1f %12.1f\n", (unsigned long long)sizes[i], seconds,
+			sizes[i] / seconds, bnMemoryPeak() / 1048576.0, peakResidentKiB() / 1024.0);
+		fflush(stdout);
+		chudnovskyFree(&engine);
+	}
+	return EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+	signal(SIGINT, onInterrupt);
+
+	if (argc >= 2 && strcmp(argv[1], "-b") == 0) {
+		uint64_t maxDigits = (argc >= 3) ? strtoull(argv[2], NULL, 10) : 100000000ULL;
+		return benchmark(maxDigits);
+	}
+	if (argc >= 2 && strcmp(argv[1], "-x") == 0) {
+		if (argc < 3) {
+			return bbpCheck();
+		}
+		return bbpDigits(strtoul(argv[2], NULL, 10), (argc >= 4) ? strtoul(argv[3], NULL, 10) : 8);
+	}
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <digits> [file] | -b [maxDigits] | -x [n [count]]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	chudnovskyState_t engine;
+	chudnovskyInit(&engine, strtoull(argv[1], NULL, 10));
+	double seconds = runEngine(&engine, true);
+	if (seconds < 0) {
+		chudnovskyFree(&engine);
+		return EXIT_FAILURE;
+	}
+
+	FILE *file = (argc >= 3) ? fopen(argv[2], "w") : stdout;
+	if (file == NULL) {
+		perror(argv[2]);
+		chudnovskyFree(&engine);
+		return EXIT_FAILURE;
+	}
+	chudnovskyWrite(&engine, file);
+	if (file != stdout) {
+		fclose(file);
+	}
+	fprintf(stderr, "%llu digits in %.2fs, %.0f digits/s, peak %.1f MiB\n",
+		(unsigned long long)engine.digits, seconds, engine.digits / seconds, bnMemoryPeak() / 1048576.0);
+	chudnovskyFree(&engine);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,230 @@
+/*
+ * traceToChrome.c
+ *
+ * Created: 16.10.2026
+ *
+ * Converts a scheduler trace of the board (traceRecorder.h) into the Chrome
+ * trace event format, which chrome://tracing and ui.perfetto.dev open.
+ *
+ *   traceToChrome <dump> [out.json]     writes to stdout without out.json
+ *
+ * The dump is either a telemetry log with the "trace,<offset>,<hex>" lines
+ * of a long press of Reset, or a binary memory dump (e.g. of the simulator)
+ * that holds the trace block somewhere. Every task gets a track with a
+ * slice from each switch-in to its switch-out; queue, event group and
+ * notification events are instants on the track of the running task, the
+ * interrupt ones on an "ISR" track.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "traceRecorder.h"
+
+// Largest block accepted, 64 KB covers every ring the XMEGA can hold
+#define TRACE_MAX_BYTES		65536
+
+static const char *const objectKind[] = {
+	[TRACE_QUEUE_SEND] = "send queue",
+	[TRACE_QUEUE_RECEIVE] = "receive queue",
+	[TRACE_QUEUE_SEND_ISR] = "send queue",
+	[TRACE_QUEUE_RECEIVE_ISR] = "receive queue",
+	[TRACE_EVENT_GROUP_SET] = "set event group",
+};
+
+static char taskNames[TRACE_TASKS + 1][TRACE_NAME_LENGTH + 1];
+
+static unsigned char *readFile(const char *path, size_t *size)
+{
+	FILE *file = fopen(path, "rb");
+	if (file == NULL) {
+		return NULL;
+	}
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	unsigned char *data = malloc(length + 1);
+	if (data == NULL || fread(data, 1, length, file) != (size_t)length) {
+		fclose(file);
+		free(data);
+		return NULL;
+	}
+	data[length] = '\0';
+	fclose(file);
+	*size = (size_t)length;
+	return data;
+}
+
+// Collects the "trace,<offset>,<hex>" lines of a telemetry log into block,
+// returns the bytes found (0 = no such line)
+static size_t parseTelemetry(const char *text, unsigned char *block)
+{
+	size_t end = 0;
+
+	for (const char *line = strstr(text, "trace,"); line != NULL; line = strstr(line + 1, "trace,")) {
+		char *hex;
+		unsigned long offset = strtoul(line + 6, &hex, 10);
+		if (*hex != ',') {
+			continue;
+		}
+		hex++;
+		for (; hex[0] != '\0' && hex[1] != '\0' && offset < TRACE_MAX_BYTES; hex += 2, offset++) {
+			unsigned byte;
+			if (!isxdigit((unsigned char)hex[0]) || !isxdigit((unsigned char)hex[1]) || sscanf(hex, "%2x", &byte) != 1) {
+				break;
+			}
+			block[offset] = (unsigned char)byte;
+		}
+		if (offset > end) {
+			end = offset;
+		}
+	}
+	return end;
+}
+
+// Finds the trace block in a memory dump, NULL if there is none
+static const traceBuffer_t *findBlock(const unsigned char *data, size_t size)
+{
+	for (size_t i = 0; i + sizeof(traceBuffer_t) <= size; i++) {
+		const traceBuffer_t *trace = (const traceBuffer_t *)(data + i);
+		if (memcmp(trace->magic, TRACE_MAGIC, 4) == 0 && trace->version == TRACE_VERSION && trace->length > 0 &&
+			trace->next < trace->length && i + sizeof(traceBuffer_t) + trace->length * sizeof(uint32_t) <= size) {
+			return trace;
+		}
+	}
+	return NULL;
+}
+
+static void writeInstant(FILE *out, const char *name, unsigned object, double time, unsigned track)
+{
+	fprintf(out, ",\n{\"name\":\"%s %u\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.1f,\"pid\":1,\"tid\":%u}",
+		name, object, time, track);
+}
+
+static void writeSlice(FILE *out, char phase, unsigned task, double time)
+{
+	fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.1f,\"pid\":1,\"tid\":%u}", taskNames[task], phase, time, task);
+}
+
+int main(int argc, char *argv[])
+{
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <dump> [out.json]\n", argv[0]);
+		return 1;
+	}
+	size_t size;
+	unsigned char *data = readFile(argv[1], &size);
+	if (data == NULL) {
+		fprintf(stderr, "cannot read %s\n", argv[1]);
+		return 1;
+	}
+
+	// A telemetry log is turned into the block first, then both are searched
+	static unsigned char telemetry[TRACE_MAX_BYTES];
+	size_t telemetryBytes = parseTelemetry((const char *)data, telemetry);
+	const traceBuffer_t *trace = (telemetryBytes > 0) ? findBlock(telemetry, telemetryBytes) : findBlock(data, size);
+	if (trace == NULL) {
+		fprintf(stderr, "no trace block in %s\n", argv[1]);
+		return 1;
+	}
+	FILE *out = (argc > 2) ? fopen(argv[2], "w") : stdout;
+	if (out == NULL) {
+		fprintf(stderr, "cannot write %s\n", argv[2]);
+		return 1;
+	}
+
+	// Track 0 takes the interrupts and events of no known task
+	strcpy(taskNames[0], "ISR");
+	fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	fprintf(out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"U_PiCalc\"}}");
+	for (unsigned task = 0; task <= TRACE_TASKS; task++) {
+		if (task > 0) {
+			memcpy(taskNames[task], trace->names[task - 1], TRACE_NAME_LENGTH);
+			if (taskNames[task][0] == '\0') {
+				sprintf(taskNames[task], "task %u", task);
+			}
+		}
+		fprintf(out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+			task, taskNames[task]);
+	}
+
+	// Oldest event first; the 24-bit time is unwrapped, so gaps must stay
+	// below 33.5 s
+	unsigned events = (trace->flags & TRACE_WRAPPED) ? trace->length : trace->next;
+	unsigned first = (trace->flags & TRACE_WRAPPED) ? trace->next : 0;
+	unsigned long long base = 0, last = 0;
+	unsigned running = 0, switches = 0;
+	double time = 0.0, start = 0.0;
+
+	// The task that runs at the oldest event is the one switched out first
+	for (unsigned n = 0; n < events; n++) {
+		uint32_t event = trace->ring[(first + n) % trace->length];
+		if (TRACE_TYPE(event) == TRACE_SWITCHED_IN) {
+			break;
+		}
+		if (TRACE_TYPE(event) == TRACE_SWITCHED_OUT && TRACE_OBJECT(event) <= TRACE_TASKS) {
+			running = TRACE_OBJECT(event);
+			break;
+		}
+	}
+	for (unsigned n = 0; n < events; n++) {
+		uint32_t event = trace->ring[(first + n) % trace->length];
+		unsigned type = TRACE_TYPE(event), object = TRACE_OBJECT(event);
+		unsigned long long ticks = base + TRACE_TIME(event);
+		if (ticks < last) {
+			base += 1ULL << 24;
+			ticks += 1ULL << 24;
+		}
+		last = ticks;
+		time = ticks * 1000.0 / trace->ticksPerMs;
+		if (n == 0) {
+			start = time;
+			if (running != 0) {
+				writeSlice(out, 'B', running, time);
+			}
+		}
+
+		switch (type) {
+		case TRACE_SWITCHED_IN:
+			if (object <= TRACE_TASKS) {
+				writeSlice(out, 'B', object, time);
+				running = object;
+				switches++;
+			}
+			break;
+		case TRACE_SWITCHED_OUT:
+			if (object == running && running != 0) {
+				writeSlice(out, 'E', object, time);
+				running = 0;
+			}
+			break;
+		case TRACE_QUEUE_SEND:
+		case TRACE_QUEUE_RECEIVE:
+		case TRACE_EVENT_GROUP_SET:
+			writeInstant(out, objectKind[type], object, time, running);
+			break;
+		case TRACE_QUEUE_SEND_ISR:
+		case TRACE_QUEUE_RECEIVE_ISR:
+			writeInstant(out, objectKind[type], object, time, 0);
+			break;
+		case TRACE_TASK_NOTIFY:
+		case TRACE_TASK_NOTIFY_ISR:
+			fprintf(out, ",\n{\"name\":\"notify %s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.1f,\"pid\":1,\"tid\":%u}",
+				(object <= TRACE_TASKS) ? taskNames[object] : "?", time, (type == TRACE_TASK_NOTIFY) ? running : 0);
+			break;
+		default:
+			break;
+		}
+	}
+	if (running != 0) {
+		writeSlice(out, 'E', running, time);
+	}
+	fprintf(out, "\n]}\n");
+	if (out != stdout) {
+		fclose(out);
+	}
+	fprintf(stderr, "%u events, %u context switches in %.1f ms\n", events, switches, (time - start) / 1000.0);
+	free(data);
+	return 0;
+}